@@ -14,6 +14,7 @@ namespace winrt::Microsoft::UI::Xaml::Controls
 #include "StackLayout.g.cpp"
 
 GlobalDependencyProperty StackLayoutProperties::s_DisableVirtualizationProperty{ nullptr };
+GlobalDependencyProperty StackLayoutProperties::s_EstimationModeProperty{ nullptr };
 GlobalDependencyProperty StackLayoutProperties::s_OrientationProperty{ nullptr };
 GlobalDependencyProperty StackLayoutProperties::s_SpacingProperty{ nullptr };
 
@@ -35,6 +36,17 @@ void StackLayoutProperties::EnsureProperties()
                 ValueHelper<bool>::BoxedDefaultValue(),
                 winrt::PropertyChangedCallback(&OnDisableVirtualizationPropertyChanged));
     }
+    if (!s_EstimationModeProperty)
+    {
+        s_EstimationModeProperty =
+            InitializeDependencyProperty(
+                L"EstimationMode",
+                winrt::name_of<winrt::StackLayoutEstimationMode>(),
+                winrt::name_of<winrt::StackLayout>(),
+                false /* isAttached */,
+                ValueHelper<winrt::StackLayoutEstimationMode>::BoxValueIfNecessary(winrt::StackLayoutEstimationMode::AverageElementSize),
+                winrt::PropertyChangedCallback(&OnEstimationModePropertyChanged));
+    }
     if (!s_OrientationProperty)
     {
         s_OrientationProperty =
@@ -62,6 +74,7 @@ void StackLayoutProperties::EnsureProperties()
 void StackLayoutProperties::ClearProperties()
 {
     s_DisableVirtualizationProperty = nullptr;
+    s_EstimationModeProperty = nullptr;
     s_OrientationProperty = nullptr;
     s_SpacingProperty = nullptr;
 }
@@ -74,6 +87,14 @@ void StackLayoutProperties::OnDisableVirtualizationPropertyChanged(
     winrt::get_self<StackLayout>(owner)->OnPropertyChanged(args);
 }
 
+void StackLayoutProperties::OnEstimationModePropertyChanged(
+    winrt::DependencyObject const& sender,
+    winrt::DependencyPropertyChangedEventArgs const& args)
+{
+    auto owner = sender.as<winrt::StackLayout>();
+    winrt::get_self<StackLayout>(owner)->OnPropertyChanged(args);
+}
+
 void StackLayoutProperties::OnOrientationPropertyChanged(
     winrt::DependencyObject const& sender,
     winrt::DependencyPropertyChangedEventArgs const& args)
@@ -103,6 +124,19 @@ bool StackLayoutProperties::DisableVirtualization()
     return ValueHelper<bool>::CastOrUnbox(static_cast<StackLayout*>(this)->GetValue(s_DisableVirtualizationProperty));
 }
 
+void StackLayoutProperties::EstimationMode(winrt::StackLayoutEstimationMode const& value)
+{
+    [[gsl::suppress(con)]]
+    {
+    static_cast<StackLayout*>(this)->SetValue(s_EstimationModeProperty, ValueHelper<winrt::StackLayoutEstimationMode>::BoxValueIfNecessary(value));
+    }
+}
+
+winrt::StackLayoutEstimationMode StackLayoutProperties::EstimationMode()
+{
+    return ValueHelper<winrt::StackLayoutEstimationMode>::CastOrUnbox(static_cast<StackLayout*>(this)->GetValue(s_EstimationModeProperty));
+}
+
 void StackLayoutProperties::Orientation(winrt::Orientation const& value)
 {
     [[gsl::suppress(con)]]
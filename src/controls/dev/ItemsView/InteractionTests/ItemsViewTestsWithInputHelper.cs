@@ -4,6 +4,7 @@
 using Common;
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Drawing;
 using Microsoft.UI.Xaml.Tests.MUXControls.InteractionTests.Infra;
 using Microsoft.UI.Xaml.Tests.MUXControls.InteractionTests.Common;
@@ -561,6 +562,22 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.InteractionTests
             KeyboardNavigationWithFastKeystrokes(layout: "StackLayout", key: Key.PageUp);
         }
 
+        [TestMethod]
+        [TestProperty("TestSuite", "A")]
+        [TestProperty("Description", "Exercises the Down key at a rapid pace in an ItemsView with UniformGridLayout.")]
+        public void KeyDownInItemsViewAndUniformGridLayoutWithFastKeystrokes()
+        {
+            KeyboardNavigationWithFastKeystrokes(layout: "UniformGridLayout", key: Key.Down);
+        }
+
+        [TestMethod]
+        [TestProperty("TestSuite", "A")]
+        [TestProperty("Description", "Exercises the Up key at a rapid pace in an ItemsView with UniformGridLayout.")]
+        public void KeyUpInItemsViewAndUniformGridLayoutWithFastKeystrokes()
+        {
+            KeyboardNavigationWithFastKeystrokes(layout: "UniformGridLayout", key: Key.Up);
+        }
+
         [TestMethod]
         [TestProperty("TestSuite", "B")]
         [TestProperty("Description", "Exercises the Tab and Shift-Tab keystrokes to navigate through the ItemsView control with ItemContainers and Single SelectionMode.")]
@@ -2191,12 +2208,31 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.InteractionTests
                         Verify.AreEqual(999, currentItemIndex, "Verifying CurrentItemIndex is 999");
                     }
 
+                    int itemsPerLine = 0;
+
+                    if (layout == "UniformGridLayout")
+                    {
+                        // The number of items per line depends on the window width, so it is evaluated with a first keystroke.
+                        int initialItemIndex = currentItemIndex;
+
+                        Log.Comment("Pressing key once to evaluate the number of items per line");
+                        KeyboardHelper.PressKey(key);
+                        Wait.ForIdle();
+                        currentItemIndex = GetCurrentItemIndex();
+                        itemsPerLine = Math.Abs(currentItemIndex - initialItemIndex);
+                        Log.Comment($"Items per line: {itemsPerLine}");
+                        Verify.IsGreaterThan(itemsPerLine, 0, "Verifying the number of items per line is positive");
+                    }
+
                     uint numPresses = (key == Key.Up || key == Key.Down) ? 8u : 4u;
 
                     Log.Comment("Pressing repeated key " + numPresses + " times");
+                    Stopwatch stopwatch = Stopwatch.StartNew();
                     KeyboardHelper.PressKey(key, ModifierKey.None, numPresses);
 
                     Wait.ForIdle();
+                    stopwatch.Stop();
+                    Log.Comment($"Repeated keystrokes processed in {stopwatch.ElapsedMilliseconds} ms");
                     currentItemIndex = GetCurrentItemIndex();
 
                     int expectedCurrentItemIndex = 0;
@@ -2219,6 +2255,18 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.InteractionTests
                                 break;
                         }
                     }
+                    else if (layout == "UniformGridLayout")
+                    {
+                        switch (key)
+                        {
+                            case Key.Down:
+                                expectedCurrentItemIndex = (int)(numPresses + 1) * itemsPerLine;
+                                break;
+                            case Key.Up:
+                                expectedCurrentItemIndex = 999 - (int)(numPresses + 1) * itemsPerLine;
+                                break;
+                        }
+                    }
                     else
                     {
                         // layout == "StackLayout"
@@ -2264,6 +2312,11 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.InteractionTests
                                 break;
                         }
                     }
+                    else if (layout == "UniformGridLayout")
+                    {
+                        // The vertical offset depends on the number of items per line.
+                        LogScrollViewInfo(itemsViewUIObject);
+                    }
                     else
                     {
                         // layout == "StackLayout"
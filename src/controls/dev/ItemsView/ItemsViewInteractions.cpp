@@ -13,6 +13,7 @@
 #include "SharedHelpers.h"
 #include "SingleSelector.h"
 #include "ItemContainerRevokers.h"
+#include "ItemsRepeater.h"
 
 #pragma region IControlOverrides
 
@@ -142,6 +143,44 @@ int ItemsView::GetAdjacentFocusableElementByDirection(
 
     MUX_ASSERT(keyboardNavigationReferenceOffset != -1.0f);
 
+    // First ask the Layout for the closest item. It can evaluate it from its state without realizing the items in between.
+    int adjacentItemIndex = -1;
+
+    if (winrt::get_self<ItemsRepeater>(itemsRepeater)->TryGetAdjacentItemIndex(
+        currentElementIndex,
+        currentElementRect,
+        focusNavigationDirection,
+        keyboardNavigationReferenceOffset,
+        &adjacentItemIndex))
+    {
+        if (adjacentItemIndex == -1)
+        {
+            return -1;
+        }
+
+        auto adjacentElement = itemsRepeater.TryGetElement(adjacentItemIndex);
+
+        if (adjacentElement == nullptr)
+        {
+            // Bring the still unrealized item into view to realize it.
+            const bool startBringItemIntoViewSuccess = StartBringItemIntoViewInternal(true /*throwOutOfBounds*/, false /* throwOnAnyFailure */, adjacentItemIndex, nullptr /* options */);
+
+            if (!startBringItemIntoViewSuccess)
+            {
+                return -1;
+            }
+
+            adjacentElement = itemsRepeater.TryGetElement(adjacentItemIndex);
+        }
+
+        if (adjacentElement != nullptr && SharedHelpers::IsFocusableElement(adjacentElement))
+        {
+            return adjacentItemIndex;
+        }
+
+        // The closest item is not focusable. Fall back to the traversal below which skips it.
+    }
+
     bool getPreviousFocusableElement = focusNavigationDirection == winrt::FocusNavigationDirection::Up || focusNavigationDirection == winrt::FocusNavigationDirection::Left;
     bool traversalDirectionChanged = false;
     int closestElementIndex = -1;
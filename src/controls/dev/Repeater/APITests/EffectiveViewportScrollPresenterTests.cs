@@ -3,6 +3,7 @@
 
 using MUXControlsTestApp.Utilities;
 using System;
+using System.Diagnostics;
 using System.Linq;
 using Windows.Foundation;
 using Microsoft.UI.Xaml;
@@ -182,6 +183,78 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateManyListenersWhileScrolling()
+        {
+            const int listenerCount = 1000;
+            const int listenerHeight = 20;
+            const int scrollStepCount = 50;
+            const double scrollStep = 100.0;
+            var effectiveViewports = new Rect[listenerCount];
+            ScrollPresenter scrollPresenter = null;
+            var scrollCompletedEvent = new AutoResetEvent(false);
+
+            RunOnUIThread.Execute(() =>
+            {
+                var stackPanel = new StackPanel();
+
+                for (int i = 0; i < listenerCount; i++)
+                {
+                    int index = i;
+                    var listener = new Border() { Width = 200, Height = listenerHeight };
+
+                    listener.EffectiveViewportChanged += (FrameworkElement sender, EffectiveViewportChangedEventArgs args) =>
+                    {
+                        effectiveViewports[index] = args.EffectiveViewport;
+                    };
+
+                    stackPanel.Children.Add(listener);
+                }
+
+                scrollPresenter = new ScrollPresenter
+                {
+                    Content = stackPanel,
+                    Width = 200,
+                    Height = 300
+                };
+
+                scrollPresenter.ScrollCompleted += (ScrollPresenter sender, ScrollingScrollCompletedEventArgs args) =>
+                {
+                    scrollCompletedEvent.Set();
+                };
+
+                Content = scrollPresenter;
+                Content.UpdateLayout();
+            });
+            IdleSynchronizer.Wait();
+
+            Log.Comment($"Scrolling {scrollStepCount} times with {listenerCount} EffectiveViewportChanged listeners");
+            var stopwatch = Stopwatch.StartNew();
+
+            for (int step = 1; step <= scrollStepCount; step++)
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    scrollPresenter.ScrollTo(0.0, step * scrollStep, new ScrollingScrollOptions(ScrollingAnimationMode.Disabled, ScrollingSnapPointsMode.Ignore));
+                });
+                Verify.IsTrue(scrollCompletedEvent.WaitOne(DefaultWaitTimeInMS));
+                CompositionPropertySpy.SynchronouslyTickUIThread(1);
+            }
+
+            stopwatch.Stop();
+            Log.Comment($"Scroll steps completed in {stopwatch.ElapsedMilliseconds} ms, {stopwatch.ElapsedMilliseconds / (double)scrollStepCount} ms per step");
+
+            RunOnUIThread.Execute(() =>
+            {
+                double verticalOffset = scrollStepCount * scrollStep;
+
+                foreach (int index in new[] { 0, 100, (int)(verticalOffset / listenerHeight), listenerCount - 1 })
+                {
+                    Verify.AreEqual(new Rect(0, verticalOffset - index * listenerHeight, 200, 300), effectiveViewports[index]);
+                }
+            });
+        }
+
         [TestMethod]
         public void CanGrowCacheBuffer()
         {
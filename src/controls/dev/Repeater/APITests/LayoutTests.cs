@@ -319,6 +319,45 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateStackLayoutMeasuredElementSizesEstimation()
+        {
+            RunOnUIThread.Execute(() =>
+            {
+                // The first 10 items are 10 times taller than the others, so an estimation based on
+                // the average size is off for the unrealized items while the recorded sizes are exact.
+                var heights = Enumerable.Range(0, 50).Select(i => i < 10 ? 200.0 : 20.0).ToList();
+                var stackLayout = new StackLayout();
+                Verify.AreEqual(StackLayoutEstimationMode.AverageElementSize, stackLayout.EstimationMode);
+                stackLayout.EstimationMode = StackLayoutEstimationMode.MeasuredElementSizes;
+
+                var repeater = new ItemsRepeater() {
+                    Layout = stackLayout,
+                    ItemsSource = heights,
+                    ItemTemplate = GetDataTemplate("<Border Height='{Binding}' />")
+                };
+
+                var scrollViewer = new ScrollViewer() {
+                    Content = repeater,
+                    Height = 100
+                };
+                Content = scrollViewer;
+                Content.UpdateLayout();
+
+                for (int i = 0; i < heights.Count; i++)
+                {
+                    repeater.GetOrCreateElement(i);
+                    Content.UpdateLayout();
+                }
+
+                Verify.AreEqual(heights.Sum(), repeater.DesiredSize.Height);
+
+                repeater.InvalidateMeasure();
+                Content.UpdateLayout();
+                Verify.AreEqual(heights.Sum(), repeater.DesiredSize.Height);
+            });
+        }
+
         [TestMethod]
         public void VerifyStackLayoutCycleShortcut()
         {
@@ -3,6 +3,10 @@
 
 using MUXControlsTestApp.Utilities;
 using Common;
+using System.Collections.Generic;
+using System.Diagnostics;
+using System.Linq;
+using System.Numerics;
 using Microsoft.UI.Xaml.Controls;
 
 using WEX.TestExecution;
@@ -32,5 +36,102 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
                 Verify.AreEqual(LinedFlowLayoutItemsStretch.None, linedFlowLayout.ItemsStretch);
             });
         }
+
+        [TestMethod]
+        [TestProperty("Description", "Resizes a LinedFlowLayout using the fast path in small steps, refreshes its items info, and verifies the partially re-flowed lines match a complete layout.")]
+        public void ResizeAndRefreshItemsInfoWithFastPath()
+        {
+            const int itemCount = 20000;
+            const int resizeStepCount = 40;
+
+            RunOnUIThread.Execute(() =>
+            {
+                int itemsInfoRequestedCount = 0;
+                double[] desiredAspectRatios = Enumerable.Range(0, itemCount).Select(index => 0.5 + (index * 7 % 13) / 6.0).ToArray();
+                LinedFlowLayout linedFlowLayout = new LinedFlowLayout() { LineHeight = 50.0, MinItemSpacing = 4.0 };
+
+                linedFlowLayout.ItemsInfoRequested += (sender, args) =>
+                {
+                    // Provide the info for the entire collection so that the fast path is used.
+                    args.ItemsRangeStartIndex = 0;
+                    args.SetDesiredAspectRatios(desiredAspectRatios);
+                    itemsInfoRequestedCount++;
+                };
+
+                ItemsRepeater repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, itemCount).ToList(),
+                    Layout = linedFlowLayout
+                };
+
+                ScrollViewer scrollViewer = new ScrollViewer()
+                {
+                    Content = repeater,
+                    Width = 400,
+                    Height = 400
+                };
+
+                Content = scrollViewer;
+                Content.UpdateLayout();
+                Verify.IsGreaterThan(itemsInfoRequestedCount, 0);
+
+                Log.Comment($"Resizing the layout in {resizeStepCount} steps");
+                var stopwatch = Stopwatch.StartNew();
+
+                for (int step = 1; step <= resizeStepCount; step++)
+                {
+                    scrollViewer.Width = 400 + step * 10;
+                    Content.UpdateLayout();
+                }
+
+                stopwatch.Stop();
+                Log.Comment($"Resize steps completed in {stopwatch.ElapsedMilliseconds} ms, {stopwatch.ElapsedMilliseconds / (double)resizeStepCount} ms per step");
+
+                Log.Comment("Changing the aspect ratio of a displayed item and refreshing the items info");
+                desiredAspectRatios[3] *= 2.0;
+                itemsInfoRequestedCount = 0;
+                stopwatch.Restart();
+                linedFlowLayout.InvalidateItemsInfo();
+                Content.UpdateLayout();
+                stopwatch.Stop();
+                Log.Comment($"Items info refresh completed in {stopwatch.ElapsedMilliseconds} ms");
+                Verify.IsGreaterThan(itemsInfoRequestedCount, 0);
+
+                Dictionary<int, Vector3> offsets = GetRealizedElementOffsets(repeater, itemCount);
+                Verify.IsGreaterThan(offsets.Count, 0);
+
+                Log.Comment("Forcing a complete layout through a width change round-trip");
+                scrollViewer.Width += 1;
+                Content.UpdateLayout();
+                scrollViewer.Width -= 1;
+                Content.UpdateLayout();
+
+                Dictionary<int, Vector3> expectedOffsets = GetRealizedElementOffsets(repeater, itemCount);
+                Verify.AreEqual(expectedOffsets.Count, offsets.Count);
+
+                foreach (var expectedOffset in expectedOffsets)
+                {
+                    Verify.IsTrue(offsets.ContainsKey(expectedOffset.Key));
+                    Verify.AreEqual(expectedOffset.Value, offsets[expectedOffset.Key]);
+                }
+            });
+        }
+
+        private static Dictionary<int, Vector3> GetRealizedElementOffsets(ItemsRepeater repeater, int itemCount)
+        {
+            Dictionary<int, Vector3> offsets = new Dictionary<int, Vector3>();
+
+            for (int index = 0; index < itemCount; index++)
+            {
+                UIElement element = repeater.TryGetElement(index);
+
+                if (element != null)
+                {
+                    offsets.Add(index, element.ActualOffset);
+                }
+            }
+
+            return offsets;
+        }
     }
 }
@@ -5,8 +5,10 @@ using Common;
 using MUXControlsTestApp.Utilities;
 using System;
 using System.Collections.Generic;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
+using Windows.Foundation;
 using Microsoft.UI.Xaml;
 using Microsoft.UI.Xaml.Controls;
 using Microsoft.UI.Xaml.Markup;
@@ -161,6 +163,96 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             }
         }
 
+        [TestMethod]
+        public void ValidatePhaseOrderingWhileScrolling()
+        {
+            ItemsRepeater repeater = null;
+            ScrollViewer scrollViewer = null;
+            int numPhases = 4; // 0 to 3
+            int numScrolls = 20;
+            var stopwatch = new Stopwatch();
+            ManualResetEvent buildTreeCompleted = new ManualResetEvent(false);
+            TypedEventHandler<object, object> buildTreeCompletedHandler = (sender, args) =>
+            {
+                buildTreeCompleted.Set();
+            };
+
+            RunOnUIThread.Execute(() =>
+            {
+                ElementPhasingManager.ProcessedCalls?.Clear();
+
+                repeater = new ItemsRepeater()
+                {
+                    ItemsSource = Enumerable.Range(0, 2000),
+                    ItemTemplate = new CustomElementFactory(numPhases),
+                    Layout = new StackLayout(),
+                };
+
+                scrollViewer = new ScrollViewer
+                {
+                    Content = repeater
+                };
+
+                Content = new ItemsRepeaterScrollHost()
+                {
+                    Width = 400,
+                    Height = 400,
+                    ScrollViewer = scrollViewer
+                };
+
+                RepeaterTestHooks.BuildTreeCompleted += buildTreeCompletedHandler;
+            });
+
+            IdleSynchronizer.Wait();
+
+            // Jump a few pages at a time without waiting for the pending phases to complete, so that many elements
+            // get cleared while they still have pending phases.
+            RunOnUIThread.Execute(() => stopwatch.Start());
+
+            for (int i = 1; i <= numScrolls; i++)
+            {
+                RunOnUIThread.Execute(() =>
+                {
+                    // Only the completion following the last scroll is of interest.
+                    buildTreeCompleted.Reset();
+                    scrollViewer.ChangeView(null, i * 1000.0, null, disableAnimation: true);
+                    repeater.UpdateLayout();
+                });
+            }
+
+            Verify.IsTrue(buildTreeCompleted.WaitOne(TimeSpan.FromMilliseconds(5000)), "Waiting for the build tree to complete.");
+
+            RunOnUIThread.Execute(() =>
+            {
+                stopwatch.Stop();
+                RepeaterTestHooks.BuildTreeCompleted -= buildTreeCompletedHandler;
+                Log.Comment($"Phased {numScrolls} scrolls in {stopwatch.ElapsedMilliseconds} ms");
+
+                var calls = ElementPhasingManager.ProcessedCalls;
+
+                foreach (var index in calls.Keys)
+                {
+                    var phases = calls[index];
+
+                    // An element can be cleared before its last phase, and realized again from phase 0.
+                    for (int i = 1; i < phases.Count; i++)
+                    {
+                        if (phases[i] != 0)
+                        {
+                            Verify.AreEqual(phases[i - 1] + 1, phases[i], $"Verifying the phase ordering of item {index}");
+                        }
+                    }
+
+                    if (repeater.TryGetElement(index) != null)
+                    {
+                        Verify.AreEqual(numPhases - 1, phases.Last(), $"Verifying realized item {index} reached its last phase");
+                    }
+                }
+
+                ElementPhasingManager.ProcessedCalls.Clear();
+            });
+        }
+
         private class CustomElementFactory : ElementFactory
         {
             private int _numPhases;
@@ -7,6 +7,7 @@ using MUXControlsTestApp.Utilities;
 using System;
 using System.Collections.Generic;
 using System.Collections.ObjectModel;
+using System.Diagnostics;
 using System.Linq;
 using System.Threading;
 using Windows.Foundation;
@@ -338,6 +339,52 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests.RepeaterTests
             });
         }
 
+        [TestMethod]
+        public void ValidateIndicesAfterManySingleItemChanges()
+        {
+            CustomItemsSource dataSource = null;
+            RunOnUIThread.Execute(() => dataSource = new CustomItemsSource(Enumerable.Range(0, 100).ToList()));
+
+            var repeater = SetupRepeater(dataSource, @"<Button Content='{Binding}' Height='10' />");
+
+            RunOnUIThread.Execute(() =>
+            {
+                const int changeCount = 200;
+                var stopwatch = Stopwatch.StartNew();
+
+                // Single item inserts at the top, like a live feed, with removals past the realized range.
+                // The layout only runs after all the changes.
+                Log.Comment($"Inserting {changeCount} items at index 0 and removing {changeCount} items at the end, one at a time");
+                for (int i = 0; i < changeCount; i++)
+                {
+                    dataSource.Insert(index: 0, count: 1, reset: false, valueStart: 1000 + i);
+                    dataSource.Remove(index: dataSource.Inner.Count - 1, count: 1, reset: false);
+                }
+
+                stopwatch.Stop();
+                Log.Comment($"Collection changes processed in {stopwatch.ElapsedMilliseconds} ms");
+
+                stopwatch.Restart();
+                repeater.UpdateLayout();
+                stopwatch.Stop();
+                Log.Comment($"Layout completed in {stopwatch.ElapsedMilliseconds} ms");
+
+                int realizedCount = 0;
+                for (int index = 0; index < dataSource.Inner.Count; index++)
+                {
+                    var element = (Button)repeater.TryGetElement(index);
+                    if (element != null)
+                    {
+                        realizedCount++;
+                        Verify.AreEqual(index, repeater.GetElementIndex(element));
+                        Verify.AreEqual(dataSource.Inner[index], (int)element.Content);
+                    }
+                }
+
+                Verify.IsGreaterThan(realizedCount, 0);
+            });
+        }
+
         [TestMethod]
         public void ValidateElementIndexChangedEventOnStableReset()
         {
@@ -20,6 +20,8 @@ ChildrenInTabFocusOrderIterable::First()
 
 ChildrenInTabFocusOrderIterable::ChildrenInTabFocusOrderIterator::ChildrenInTabFocusOrderIterator(const winrt::ItemsRepeater& repeater)
 {
+    winrt::get_self<ItemsRepeater>(repeater)->ViewManager().ApplyPendingIndexChanges();
+
     auto children = repeater.as<winrt::Panel>().Children();
     m_realizedChildren.reserve(children.Size());
 
@@ -92,6 +92,34 @@ void FlowLayout::OnItemsChangedCore(
 
 #pragma endregion
 
+#pragma region ILayoutOverrides
+
+bool FlowLayout::TryGetAdjacentItemIndex(
+    winrt::VirtualizingLayoutContext const& context,
+    int itemIndex,
+    winrt::Rect const& itemRect,
+    winrt::FocusNavigationDirection const& focusNavigationDirection,
+    float referenceOffset,
+    int* adjacentItemIndex)
+{
+    *adjacentItemIndex = -1;
+
+    const bool isVerticalDirection = focusNavigationDirection == winrt::FocusNavigationDirection::Up || focusNavigationDirection == winrt::FocusNavigationDirection::Down;
+
+    if (isVerticalDirection != (GetScrollOrientation() == ScrollOrientation::Vertical))
+    {
+        // Only moves to a neighboring line are supported.
+        return false;
+    }
+
+    const bool forward = focusNavigationDirection == winrt::FocusNavigationDirection::Down || focusNavigationDirection == winrt::FocusNavigationDirection::Right;
+    const float minorOffsetDelta = referenceOffset - MinorStart(itemRect) - MinorSize(itemRect) / 2.0f;
+
+    return GetFlowAlgorithm(context).TryGetAdjacentLineItemIndex(itemIndex, forward, minorOffsetDelta, adjacentItemIndex);
+}
+
+#pragma endregion
+
 #pragma region IFlowLayoutOverrides
 
 winrt::Size FlowLayout::GetMeasureSize(
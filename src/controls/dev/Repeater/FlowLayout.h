@@ -38,6 +38,16 @@ public:
         winrt::NotifyCollectionChangedEventArgs const& args);
 #pragma endregion
 
+#pragma region ILayoutOverrides
+    bool TryGetAdjacentItemIndex(
+        winrt::VirtualizingLayoutContext const& context,
+        int itemIndex,
+        winrt::Rect const& itemRect,
+        winrt::FocusNavigationDirection const& focusNavigationDirection,
+        float referenceOffset,
+        int* adjacentItemIndex) override;
+#pragma endregion
+
 #pragma region IFlowLayoutOverrides
     winrt::Size GetMeasureSize(
          int index,
@@ -758,6 +758,106 @@ winrt::UIElement FlowLayoutAlgorithm::GetElementIfRealized(int dataIndex)
     return  nullptr;
 }
 
+// Sets adjacentItemIndex to the item of the line before or after the itemIndex item's line whose arranged center is the
+// closest to the itemIndex item's arranged center shifted by minorOffsetDelta, or to -1 when there is no such line.
+// Like ArrangeVirtualizingLayout, lines are told apart by the major start of the realized layout bounds.
+// Returns False when the neighboring line is not entirely realized.
+bool FlowLayoutAlgorithm::TryGetAdjacentLineItemIndex(
+    int itemIndex,
+    bool forward,
+    float minorOffsetDelta,
+    int* adjacentItemIndex)
+{
+    *adjacentItemIndex = -1;
+
+    if (!m_elementManager.IsDataIndexRealized(itemIndex))
+    {
+        return false;
+    }
+
+    const auto getArrangedMinorCenter = [this](int dataIndex, float* minorCenter)
+    {
+        if (auto const element = m_elementManager.GetRealizedElement(dataIndex).try_as<winrt::FrameworkElement>())
+        {
+            const winrt::Rect layoutSlot = CachedVisualTreeHelpers::GetLayoutSlot(element);
+
+            *minorCenter = MinorStart(layoutSlot) + MinorSize(layoutSlot) / 2.0f;
+            return true;
+        }
+        return false;
+    };
+
+    float targetMinorCenter{};
+
+    if (!getArrangedMinorCenter(itemIndex, &targetMinorCenter))
+    {
+        return false;
+    }
+
+    targetMinorCenter += minorOffsetDelta;
+
+    const int step = forward ? 1 : -1;
+    const float lineMajorStart = MajorStart(m_elementManager.GetLayoutBoundsForDataIndex(itemIndex));
+    int dataIndex = itemIndex + step;
+
+    // Skip the remaining items of the current line.
+    while (m_elementManager.IsIndexValidInData(dataIndex) &&
+        m_elementManager.IsDataIndexRealized(dataIndex) &&
+        MajorStart(m_elementManager.GetLayoutBoundsForDataIndex(dataIndex)) == lineMajorStart)
+    {
+        dataIndex += step;
+    }
+
+    if (!m_elementManager.IsIndexValidInData(dataIndex))
+    {
+        // The current line is the first or last one.
+        return true;
+    }
+
+    if (!m_elementManager.IsDataIndexRealized(dataIndex))
+    {
+        return false;
+    }
+
+    const float adjacentLineMajorStart = MajorStart(m_elementManager.GetLayoutBoundsForDataIndex(dataIndex));
+    float smallestDistance = std::numeric_limits<float>::max();
+    int closestItemIndex = -1;
+
+    while (m_elementManager.IsIndexValidInData(dataIndex))
+    {
+        if (!m_elementManager.IsDataIndexRealized(dataIndex))
+        {
+            // The end of the adjacent line is not known.
+            return false;
+        }
+
+        if (MajorStart(m_elementManager.GetLayoutBoundsForDataIndex(dataIndex)) != adjacentLineMajorStart)
+        {
+            break;
+        }
+
+        float minorCenter{};
+
+        if (!getArrangedMinorCenter(dataIndex, &minorCenter))
+        {
+            return false;
+        }
+
+        const float distance = std::abs(minorCenter - targetMinorCenter);
+
+        if (distance < smallestDistance)
+        {
+            smallestDistance = distance;
+            closestItemIndex = dataIndex;
+        }
+
+        dataIndex += step;
+    }
+
+    *adjacentItemIndex = closestItemIndex;
+    return true;
+}
+
 bool FlowLayoutAlgorithm::IsVirtualizingContext()
 {
     if (m_context)
@@ -29,6 +29,7 @@ public:
 
     // Methods
     winrt::Rect LastExtent() const { return m_lastExtent; }
+    winrt::Size LastAvailableSize() const { return m_lastAvailableSize; }
 
     void InitializeForContext(const winrt::VirtualizingLayoutContext& context, IFlowLayoutAlgorithmDelegates* callbacks);
     void UninitializeForContext(const winrt::VirtualizingLayoutContext& context);
@@ -62,6 +63,12 @@ public:
 
     winrt::UIElement GetElementIfRealized(int dataindex);
 
+    bool TryGetAdjacentLineItemIndex(
+        int itemIndex,
+        bool forward,
+        float minorOffsetDelta,
+        int* adjacentItemIndex);
+
 private:
     // Types
     enum class GenerateDirection
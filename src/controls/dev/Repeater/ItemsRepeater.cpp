@@ -5,6 +5,7 @@
 #include <common.h>
 #include "ItemsRepeater.common.h"
 #include "ItemsRepeater.h"
+#include "Layout.h"
 #include "RepeaterLayoutContext.h"
 #include "ChildrenInTabFocusOrderIterable.h"
 #include "SharedHelpers.h"
@@ -101,6 +102,9 @@ winrt::Size ItemsRepeater::MeasureOverride(winrt::Size const& availableSize)
 
     m_viewportManager->OnOwnerMeasuring();
 
+    // Apply the index changes of the collection changes since the last layout in a single pass.
+    m_viewManager.ApplyPendingIndexChanges();
+
     m_isLayoutInProgress = true;
     auto layoutInProgress = gsl::finally([this]()
         {
@@ -259,6 +263,29 @@ winrt::UIElement ItemsRepeater::GetOrCreateElement(int index)
 
 #pragma endregion
 
+bool ItemsRepeater::TryGetAdjacentItemIndex(
+    int itemIndex,
+    winrt::Rect const& itemRect,
+    winrt::FocusNavigationDirection const& focusNavigationDirection,
+    float referenceOffset,
+    int* adjacentItemIndex)
+{
+    *adjacentItemIndex = -1;
+
+    // The layout state is out of date while a collection change or a layout pass is processed.
+    if (m_isLayoutInProgress || IsProcessingCollectionChange())
+    {
+        return false;
+    }
+
+    if (auto const layout = GetEffectiveLayout().try_as<::Layout>())
+    {
+        return layout->TryGetAdjacentItemIndex(GetLayoutContext(), itemIndex, itemRect, focusNavigationDirection, referenceOffset, adjacentItemIndex);
+    }
+
+    return false;
+}
+
 winrt::UIElement ItemsRepeater::GetElementImpl(int index, bool forceCreate, bool suppressAutoRecycle)
 {
     auto element = m_viewManager.GetElement(index, forceCreate, suppressAutoRecycle);
@@ -296,6 +323,8 @@ winrt::UIElement ItemsRepeater::GetElementFromIndexImpl(int index)
 {
     winrt::UIElement result = nullptr;
 
+    m_viewManager.ApplyPendingIndexChanges();
+
     auto children = Children();
     for (unsigned i = 0u; i < children.Size() && !result; ++i)
     {
@@ -97,6 +97,14 @@ public:
     winrt::Point LayoutOrigin() const { return m_layoutOrigin; }
     void LayoutOrigin(winrt::Point value) { m_layoutOrigin = value; }
 
+    // Keyboard navigation support for ItemsView, see Layout::TryGetAdjacentItemIndex.
+    bool TryGetAdjacentItemIndex(
+        int itemIndex,
+        winrt::Rect const& itemRect,
+        winrt::FocusNavigationDirection const& focusNavigationDirection,
+        float referenceOffset,
+        int* adjacentItemIndex);
+
     // Pinning APIs
     void PinElement(winrt::UIElement const& element);
     void UnpinElement(winrt::UIElement const& element);
@@ -36,6 +36,23 @@ public:
     virtual winrt::ItemCollectionTransitionProvider CreateDefaultItemTransitionProvider() { return nullptr; }
 #pragma endregion
 
+    // Used by ItemsView's keyboard navigation. Sets adjacentItemIndex to the item closest to referenceOffset among the items
+    // placed next to the realized item itemIndex in the focusNavigationDirection direction, or to -1 when there is no such item.
+    // itemRect is the bounds of the itemIndex item and referenceOffset is a horizontal (Up/Down) or vertical (Left/Right)
+    // offset, both in the ItemsRepeater's coordinate space.
+    // Returns False when the answer cannot be computed from the layout state alone, i.e. without realizing items.
+    virtual bool TryGetAdjacentItemIndex(
+        winrt::VirtualizingLayoutContext const& /*context*/,
+        int /*itemIndex*/,
+        winrt::Rect const& /*itemRect*/,
+        winrt::FocusNavigationDirection const& /*focusNavigationDirection*/,
+        float /*referenceOffset*/,
+        int* adjacentItemIndex)
+    {
+        *adjacentItemIndex = -1;
+        return false;
+    }
+
 #pragma region ILayoutProtected
     void InvalidateMeasure();
     void InvalidateArrange();
@@ -203,6 +203,140 @@ winrt::ItemCollectionTransitionProvider LinedFlowLayout::CreateDefaultItemTransi
     return winrt::make<LinedFlowLayoutItemCollectionTransitionProvider>();
 }
 
+// Uses the m_lineItemCounts vector to find the line above or below the itemIndex item. The closest item in that line is picked
+// based on the realized elements' layout slots.
+bool LinedFlowLayout::TryGetAdjacentItemIndex(
+    winrt::VirtualizingLayoutContext const& /*context*/,
+    int itemIndex,
+    winrt::Rect const& itemRect,
+    winrt::FocusNavigationDirection const& focusNavigationDirection,
+    float referenceOffset,
+    int* adjacentItemIndex)
+{
+    *adjacentItemIndex = -1;
+
+    if (focusNavigationDirection != winrt::FocusNavigationDirection::Up && focusNavigationDirection != winrt::FocusNavigationDirection::Down)
+    {
+        // Only moves to a neighboring line are supported.
+        return false;
+    }
+
+    const int sizedLineVectorCount = static_cast<int>(m_lineItemCounts.size());
+    const int firstSizedItemIndex = m_firstSizedItemIndex == -1 ? 0 : m_firstSizedItemIndex;
+
+    if (sizedLineVectorCount == 0 || itemIndex < firstSizedItemIndex || itemIndex >= m_itemCount)
+    {
+        return false;
+    }
+
+    int lineVectorIndex = 0;
+    int firstItemIndexInLine = firstSizedItemIndex;
+
+    while (lineVectorIndex < sizedLineVectorCount && itemIndex >= firstItemIndexInLine + m_lineItemCounts[lineVectorIndex])
+    {
+        firstItemIndexInLine += m_lineItemCounts[lineVectorIndex];
+        lineVectorIndex++;
+    }
+
+    if (lineVectorIndex == sizedLineVectorCount)
+    {
+        return false;
+    }
+
+    int firstItemIndexInAdjacentLine{ -1 };
+    int adjacentLineItemsCount{ 0 };
+
+    if (focusNavigationDirection == winrt::FocusNavigationDirection::Down)
+    {
+        firstItemIndexInAdjacentLine = firstItemIndexInLine + m_lineItemCounts[lineVectorIndex];
+
+        if (firstItemIndexInAdjacentLine >= m_itemCount)
+        {
+            // The item is in the last line.
+            return true;
+        }
+
+        if (lineVectorIndex == sizedLineVectorCount - 1)
+        {
+            return false;
+        }
+
+        adjacentLineItemsCount = m_lineItemCounts[lineVectorIndex + 1];
+    }
+    else
+    {
+        if (firstItemIndexInLine == 0)
+        {
+            // The item is in the first line.
+            return true;
+        }
+
+        if (lineVectorIndex == 0)
+        {
+            return false;
+        }
+
+        adjacentLineItemsCount = m_lineItemCounts[lineVectorIndex - 1];
+        firstItemIndexInAdjacentLine = firstItemIndexInLine - adjacentLineItemsCount;
+    }
+
+    if (firstItemIndexInAdjacentLine + adjacentLineItemsCount > m_itemCount)
+    {
+        // The lines are out of date.
+        return false;
+    }
+
+    const auto getArrangedCenter = [this](int realizedItemIndex, float* center)
+    {
+        if (!m_elementManager.IsDataIndexRealized(realizedItemIndex))
+        {
+            return false;
+        }
+
+        if (auto const element = m_elementManager.GetRealizedElement(realizedItemIndex /*dataIndex*/).try_as<winrt::FrameworkElement>())
+        {
+            const winrt::Rect layoutSlot = CachedVisualTreeHelpers::GetLayoutSlot(element);
+
+            *center = layoutSlot.X + layoutSlot.Width / 2.0f;
+            return true;
+        }
+
+        return false;
+    };
+
+    float targetCenter{};
+
+    if (!getArrangedCenter(itemIndex, &targetCenter))
+    {
+        return false;
+    }
+
+    targetCenter += referenceOffset - itemRect.X - itemRect.Width / 2.0f;
+
+    float smallestDistance = std::numeric_limits<float>::max();
+
+    for (int lineItemIndex = firstItemIndexInAdjacentLine; lineItemIndex < firstItemIndexInAdjacentLine + adjacentLineItemsCount; lineItemIndex++)
+    {
+        float center{};
+
+        if (!getArrangedCenter(lineItemIndex, &center))
+        {
+            *adjacentItemIndex = -1;
+            return false;
+        }
+
+        const float distance = std::abs(center - targetCenter);
+
+        if (distance < smallestDistance)
+        {
+            smallestDistance = distance;
+            *adjacentItemIndex = lineItemIndex;
+        }
+    }
+
+    return true;
+}
+
 #pragma endregion
 
 #pragma region IVirtualizingLayoutOverrides
@@ -1816,9 +1950,11 @@ void LinedFlowLayout::ComputeItemsLayoutWithLockedItems(
 }
 
 // Computes the best layout by assigning items to lines - for the fast path.
-// This method populates the m_itemsInfoArrangeWidths and m_lineItemCounts vectors successively, using the
+// This method populates the m_itemsInfoArrangeWidths, m_lineItemCounts and m_lineFirstItemIndexes vectors successively, using the
 // m_itemsInfoDesiredAspectRatiosForFastPath, m_itemsInfoMinWidthsForFastPath, m_itemsInfoMaxWidthsForFastPath,
 // m_itemsInfoMinWidth, m_itemsInfoMaxWidth fields.
+// Lines preceding the first changed item, and lines following the last changed item once a line starts on
+// the same item as in the previous solution, are copied from m_previousFastPathLayout instead of being re-flowed.
 // Returns the largest line width among all the lines.
 float LinedFlowLayout::ComputeItemsLayoutFastPath(
     float availableWidth,
@@ -1833,12 +1969,67 @@ float LinedFlowLayout::ComputeItemsLayoutFastPath(
     // The existing average aspect ratio is used as a fallback aspect ratio for items
     // given an aspect ratio <= 0 by the ItemsInfoRequested handler.
     const double averageAspectRatio = GetAverageAspectRatio(availableWidth, actualLineHeight);
+    bool usesAverageAspectRatio{ false };
 
     for (int itemIndex = 0; itemIndex < m_itemCount; itemIndex++)
     {
         const float arrangeWidth = GetArrangeWidthFromItemsInfo(itemIndex, actualLineHeight, averageAspectRatio);
 
         SetArrangeWidthFromItemsInfo(itemIndex, arrangeWidth);
+
+        usesAverageAspectRatio |= GetDesiredAspectRatioFromItemsInfo(itemIndex, true /*usesFastPathLayout*/) <= 0;
+    }
+
+    const float minItemSpacing{ static_cast<float>(MinItemSpacing()) };
+    const bool itemsAreStretched{ ItemsStretch() == winrt::LinedFlowLayoutItemsStretch::Fill };
+    const FastPathLayout previousLayout(std::move(m_previousFastPathLayout));
+    const std::vector<int> previousLineFirstItemIndexes(std::move(m_lineFirstItemIndexes));
+    const int previousLineCount = static_cast<int>(previousLineFirstItemIndexes.size()) - 1;
+    const int previousItemCount = previousLineCount > 0 ? previousLineFirstItemIndexes[previousLineCount] : 0;
+    const int itemCountDelta = m_itemCount - previousItemCount;
+    // The previous solution can only be partially reused when all the inputs shared by the items are unchanged.
+    // The average aspect ratio only matters when at least one item falls back to it.
+    const bool canReusePreviousLayout =
+        previousLineCount > 0 &&
+        previousLayout.m_availableWidth == availableWidth &&
+        previousLayout.m_actualLineHeight == actualLineHeight &&
+        previousLayout.m_minItemSpacing == minItemSpacing &&
+        previousLayout.m_itemsAreStretched == itemsAreStretched &&
+        previousLayout.m_itemsInfoMinWidth == m_itemsInfoMinWidth &&
+        previousLayout.m_itemsInfoMaxWidth == m_itemsInfoMaxWidth &&
+        (!usesAverageAspectRatio || previousLayout.m_averageAspectRatio == averageAspectRatio);
+    // Items after lastChangedItemIndex are identical to the previous items after lastChangedItemIndex - itemCountDelta.
+    int lastChangedItemIndex{ m_itemCount - 1 };
+    int restartLineIndex{ 0 };
+
+    if (canReusePreviousLayout)
+    {
+        int firstChangedItemIndex{ 0 };
+
+        while (firstChangedItemIndex < std::min(m_itemCount, previousItemCount) &&
+            FastPathItemsInfoMatches(previousLayout, firstChangedItemIndex, firstChangedItemIndex))
+        {
+            firstChangedItemIndex++;
+        }
+
+        while (lastChangedItemIndex >= firstChangedItemIndex &&
+            lastChangedItemIndex - itemCountDelta >= firstChangedItemIndex &&
+            FastPathItemsInfoMatches(previousLayout, lastChangedItemIndex, lastChangedItemIndex - itemCountDelta))
+        {
+            lastChangedItemIndex--;
+        }
+
+        // The line holding the item preceding the first changed item is re-flowed too since its end may
+        // have been decided by comparing its shrinking and expanding factors with the first changed item.
+        const int lastUnchangedItemIndex = std::max(0, firstChangedItemIndex - 1);
+
+        restartLineIndex = static_cast<int>(std::upper_bound(
+            previousLineFirstItemIndexes.begin(),
+            previousLineFirstItemIndexes.end() - 1,
+            lastUnchangedItemIndex) - previousLineFirstItemIndexes.begin()) - 1;
+
+        MUX_ASSERT(restartLineIndex >= 0);
+        MUX_ASSERT(restartLineIndex < previousLineCount);
     }
 
     // Final line count is originally unknown. m_lineItemCounts is originally allocated to accommodate 5 items per line.
@@ -1846,19 +2037,97 @@ float LinedFlowLayout::ComputeItemsLayoutFastPath(
     constexpr int c_itemsPerLineAllocation = 5;
     // The vector capacity is increased by 25% each time its size becomes too small.
     constexpr double c_lineCountGrowthFactor = 1.25;
-    int allocatedLineCount{ m_itemCount / c_itemsPerLineAllocation + 1 };
+    int allocatedLineCount{ std::max(m_itemCount / c_itemsPerLineAllocation + 1, restartLineIndex + 1) };
 
     EnsureLineItemCounts(allocatedLineCount);
 
-    const float minItemSpacing{ static_cast<float>(MinItemSpacing()) };
-    const bool itemsAreStretched{ ItemsStretch() == winrt::LinedFlowLayoutItemsStretch::Fill };
+    std::vector<float> lineWidths;
     int lineIndex{ -1 };
     int lineItemCount{ 0 };
     float lineWidth{ 0.0f };
     float maxLineWidth{ 0.0f };
 
-    for (int itemIndex = 0; itemIndex < m_itemCount; itemIndex++)
+    // Records the final width of a completed line.
+    const auto setLineWidth = [&lineWidths, &maxLineWidth](int completedLineIndex, float completedLineWidth)
+    {
+        if (static_cast<int>(lineWidths.size()) <= completedLineIndex)
+        {
+            lineWidths.resize(completedLineIndex + 1, 0.0f);
+        }
+
+        lineWidths[completedLineIndex] = completedLineWidth;
+        maxLineWidth = std::max(completedLineWidth, maxLineWidth);
+    };
+
+    // Copies the previous lines [previousLineIndex, previousEndLineIndex) into the current lines starting at
+    // firstLineIndex, along with the final arrange widths of their items shifted by itemIndexOffset.
+    const auto copyPreviousLines = [&](int previousLineIndex, int previousEndLineIndex, int firstLineIndex, int itemIndexOffset)
+    {
+        const int copiedLineCount = previousEndLineIndex - previousLineIndex;
+
+        if (static_cast<int>(m_lineItemCounts.size()) < firstLineIndex + copiedLineCount)
+        {
+            m_lineItemCounts.resize(firstLineIndex + copiedLineCount, 0);
+        }
+
+        for (int lineOffset = 0; lineOffset < copiedLineCount; lineOffset++)
+        {
+            m_lineItemCounts[firstLineIndex + lineOffset] =
+                previousLineFirstItemIndexes[previousLineIndex + lineOffset + 1] - previousLineFirstItemIndexes[previousLineIndex + lineOffset];
+            setLineWidth(firstLineIndex + lineOffset, previousLayout.m_lineWidths[previousLineIndex + lineOffset]);
+        }
+
+        const int previousBeginItemIndex = previousLineFirstItemIndexes[previousLineIndex];
+
+        std::copy(
+            previousLayout.m_arrangeWidths.begin() + previousBeginItemIndex,
+            previousLayout.m_arrangeWidths.begin() + previousLineFirstItemIndexes[previousEndLineIndex],
+            m_itemsInfoArrangeWidths.begin() + previousBeginItemIndex + itemIndexOffset);
+    };
+
+    // Once a line starts on an unchanged item which also started a previous line, all the following lines are
+    // identical to the previous ones since they only depend on the items from that one on.
+    // Returns True when the remaining lines were copied from the previous solution.
+    const auto copyConvergedLines = [&](int firstItemIndex, int firstLineIndex) -> bool
+    {
+        if (!canReusePreviousLayout || firstItemIndex <= lastChangedItemIndex)
+        {
+            return false;
+        }
+
+        const int previousFirstItemIndex = firstItemIndex - itemCountDelta;
+        const auto previousLineIterator = std::lower_bound(
+            previousLineFirstItemIndexes.begin(),
+            previousLineFirstItemIndexes.end() - 1,
+            previousFirstItemIndex);
+
+        if (previousLineIterator == previousLineFirstItemIndexes.end() - 1 || *previousLineIterator != previousFirstItemIndex)
+        {
+            return false;
+        }
+
+        const int previousLineIndex = static_cast<int>(previousLineIterator - previousLineFirstItemIndexes.begin());
+
+        copyPreviousLines(previousLineIndex, previousLineCount, firstLineIndex, itemCountDelta);
+        lineIndex = firstLineIndex + previousLineCount - previousLineIndex - 1;
+        lineItemCount = 0;
+        return true;
+    };
+
+    if (restartLineIndex > 0)
+    {
+        // Lines preceding the first changed item are unchanged.
+        copyPreviousLines(0, restartLineIndex, 0, 0);
+        lineIndex = restartLineIndex - 1;
+    }
+
+    for (int itemIndex = restartLineIndex == 0 ? 0 : previousLineFirstItemIndexes[restartLineIndex]; itemIndex < m_itemCount; itemIndex++)
     {
+        if (lineWidth == 0.0f && copyConvergedLines(itemIndex, lineIndex + 1))
+        {
+            break;
+        }
+
         const float arrangeWidth{ m_itemsInfoArrangeWidths[itemIndex] };
         double scaleFactor{ 1.0 };
 
@@ -1944,7 +2213,7 @@ float LinedFlowLayout::ComputeItemsLayoutFastPath(
 
                     if (scaleFactor == 1.0)
                     {
-                        maxLineWidth = std::max(lineWidth, maxLineWidth);
+                        setLineWidth(lineIndex, lineWidth);
                     }
                     else
                     {
@@ -1956,13 +2225,18 @@ float LinedFlowLayout::ComputeItemsLayoutFastPath(
                             averageAspectRatio,
                             scaleFactor);
 
-                        maxLineWidth = std::max(totalArrangeWidth + (lineItemCount - 1) * minItemSpacing, maxLineWidth);
+                        setLineWidth(lineIndex, totalArrangeWidth + (lineItemCount - 1) * minItemSpacing);
                     }
                 }
 
                 lineWidth = arrangeWidth;
                 lineItemCount = 1;
                 lineIndex++;
+
+                if (copyConvergedLines(itemIndex, lineIndex))
+                {
+                    break;
+                }
             }
         }
         else
@@ -2013,11 +2287,11 @@ float LinedFlowLayout::ComputeItemsLayoutFastPath(
                     averageAspectRatio,
                     scaleFactor);
 
-                maxLineWidth = std::max(totalArrangeWidth + (lineItemCount - 1) * minItemSpacing, maxLineWidth);
+                setLineWidth(lineIndex, totalArrangeWidth + (lineItemCount - 1) * minItemSpacing);
             }
             else
             {
-                maxLineWidth = std::max(lineWidth, maxLineWidth);
+                setLineWidth(lineIndex, lineWidth);
             }
 
             lineWidth = 0.0f;
@@ -2026,14 +2300,14 @@ float LinedFlowLayout::ComputeItemsLayoutFastPath(
     }
 
     MUX_ASSERT(lineIndex >= 0);
-    MUX_ASSERT(lineIndex < allocatedLineCount);
+    MUX_ASSERT(lineIndex < static_cast<int>(m_lineItemCounts.size()));
 
     if (lineItemCount > 0)
     {
         MUX_ASSERT(lineWidth > 0);
         MUX_ASSERT(availableWidth >= lineWidth);
 
-        maxLineWidth = std::max(lineWidth, maxLineWidth);
+        setLineWidth(lineIndex, lineWidth);
         m_lineItemCounts[lineIndex] = lineItemCount;
     }
 
@@ -2045,13 +2319,34 @@ float LinedFlowLayout::ComputeItemsLayoutFastPath(
 #endif
 
     m_lineItemCounts.resize(lineIndex + 1, 0);
+    lineWidths.resize(lineIndex + 1, 0.0f);
+
+    m_lineFirstItemIndexes.resize(lineIndex + 2);
+    m_lineFirstItemIndexes[0] = 0;
 
-#ifdef DBG
     for (int lineIndexTmp = 0; lineIndexTmp <= lineIndex; lineIndexTmp++)
     {
         MUX_ASSERT(m_lineItemCounts[lineIndexTmp] > 0);
+
+        m_lineFirstItemIndexes[lineIndexTmp + 1] = m_lineFirstItemIndexes[lineIndexTmp] + m_lineItemCounts[lineIndexTmp];
     }
-#endif
+
+    MUX_ASSERT(m_lineFirstItemIndexes[lineIndex + 1] == m_itemCount);
+
+    // Keep the inputs and outcome of this layout for the next invocation.
+    // The items info arrays are moved since ResetItemsInfoForFastPath discards them right after this call.
+    m_previousFastPathLayout.m_itemsInfoDesiredAspectRatios = std::move(m_itemsInfoDesiredAspectRatiosForFastPath);
+    m_previousFastPathLayout.m_itemsInfoMinWidths = std::move(m_itemsInfoMinWidthsForFastPath);
+    m_previousFastPathLayout.m_itemsInfoMaxWidths = std::move(m_itemsInfoMaxWidthsForFastPath);
+    m_previousFastPathLayout.m_arrangeWidths = m_itemsInfoArrangeWidths;
+    m_previousFastPathLayout.m_lineWidths = std::move(lineWidths);
+    m_previousFastPathLayout.m_itemsInfoMinWidth = m_itemsInfoMinWidth;
+    m_previousFastPathLayout.m_itemsInfoMaxWidth = m_itemsInfoMaxWidth;
+    m_previousFastPathLayout.m_actualLineHeight = actualLineHeight;
+    m_previousFastPathLayout.m_averageAspectRatio = averageAspectRatio;
+    m_previousFastPathLayout.m_availableWidth = availableWidth;
+    m_previousFastPathLayout.m_minItemSpacing = minItemSpacing;
+    m_previousFastPathLayout.m_itemsAreStretched = itemsAreStretched;
 
     return maxLineWidth;
 }
@@ -3377,6 +3672,33 @@ void LinedFlowLayout::ExitRegularPath()
     ResetSizedLines();
 }
 
+// Returns True when the ItemsInfoRequested handler provided the same sizing information for the item at itemIndex
+// as it did for the item at previousItemIndex when previousLayout was computed.
+bool LinedFlowLayout::FastPathItemsInfoMatches(
+    FastPathLayout const& previousLayout,
+    int itemIndex,
+    int previousItemIndex) const
+{
+    MUX_ASSERT(UsesFastPathLayout());
+    MUX_ASSERT(previousItemIndex >= 0);
+    MUX_ASSERT(previousItemIndex < static_cast<int>(previousLayout.m_itemsInfoDesiredAspectRatios.size()));
+
+    if (GetDesiredAspectRatioFromItemsInfo(itemIndex, true /*usesFastPathLayout*/) != previousLayout.m_itemsInfoDesiredAspectRatios[previousItemIndex])
+    {
+        return false;
+    }
+
+    // Same combinations as in GetMinWidthFromItemsInfo and GetMaxWidthFromItemsInfo.
+    const double previousMinWidth = previousItemIndex < static_cast<int>(previousLayout.m_itemsInfoMinWidths.size()) ?
+        std::max(previousLayout.m_itemsInfoMinWidth, previousLayout.m_itemsInfoMinWidths[previousItemIndex]) :
+        previousLayout.m_itemsInfoMinWidth;
+    const double previousMaxWidth = previousItemIndex < static_cast<int>(previousLayout.m_itemsInfoMaxWidths.size()) ?
+        std::min(previousLayout.m_itemsInfoMaxWidth, previousLayout.m_itemsInfoMaxWidths[previousItemIndex]) :
+        previousLayout.m_itemsInfoMaxWidth;
+
+    return GetMinWidthFromItemsInfo(itemIndex) == previousMinWidth && GetMaxWidthFromItemsInfo(itemIndex) == previousMaxWidth;
+}
+
 double LinedFlowLayout::GetArrangeWidth(
     double desiredAspectRatio,
     double minWidth,
@@ -3816,6 +4138,11 @@ int LinedFlowLayout::GetFirstItemIndexInLineIndex(
     MUX_ASSERT(lineVectorIndex >= 0);
     MUX_ASSERT(lineVectorIndex < static_cast<int>(m_lineItemCounts.size()));
 
+    if (UsesLineFirstItemIndexes())
+    {
+        return m_lineFirstItemIndexes[lineVectorIndex];
+    }
+
     int itemIndex = 0;
 
     for (int lineVectorIndexTmp = 0; lineVectorIndexTmp < lineVectorIndex; lineVectorIndexTmp++)
@@ -4750,7 +5077,15 @@ int LinedFlowLayout::GetLineIndex(
 
     int lineIndex = 0;
 
-    if (usesFastPathLayout)
+    if (usesFastPathLayout && UsesLineFirstItemIndexes())
+    {
+        // Binary search for the last line starting at or before itemIndex.
+        lineIndex = static_cast<int>(std::upper_bound(m_lineFirstItemIndexes.begin(), m_lineFirstItemIndexes.end() - 1, itemIndex) - m_lineFirstItemIndexes.begin()) - 1;
+
+        MUX_ASSERT(lineIndex >= 0);
+        MUX_ASSERT(lineIndex < static_cast<int>(m_lineItemCounts.size()));
+    }
+    else if (usesFastPathLayout)
     {
         int lineItemCounts{};
 
@@ -5733,6 +6068,8 @@ bool LinedFlowLayout::LockItemToLineInternal(
 //     The regular path involves iterative passes for assigning items to increasingly equalized lines.
 //   - a new available width always triggers a full re-layout of the entire collection. In the regular path case, no re-layout is required as long as the average-items-per-line
 //     does not change.
+//   - with an unchanged available width, only the lines affected by items with new sizing information are re-laid out. m_previousFastPathLayout retains the
+//     prior items info and outcome for that purpose.
 //   - the fast path does not have to stick to a line count based on the average item aspect ratio. It has thus more freedom to lay out items with less clipping.
 std::tuple<int, float, LinedFlowLayout::ItemsInfo> LinedFlowLayout::MeasureConstrainedLinesFastPath(
     winrt::VirtualizingLayoutContext const& context,
@@ -5819,7 +6156,7 @@ std::tuple<int, float, LinedFlowLayout::ItemsInfo> LinedFlowLayout::MeasureConst
                 actualLineHeight);
 
             // Immediately clear the arrays collected from the ItemsInfoRequested event handler.
-            // ComputeItemsLayoutFastPath called above is the only method making use of them.
+            // ComputeItemsLayoutFastPath called above is the only method making use of them, and it kept them in m_previousFastPathLayout.
             ResetItemsInfoForFastPath();
 
             m_forceRelayout = false;
@@ -7291,6 +7628,8 @@ void LinedFlowLayout::ResetItemsInfoForFastPath()
 void LinedFlowLayout::ResetLinesInfo()
 {
     m_lineItemCounts.clear();
+    m_lineFirstItemIndexes.clear();
+    m_previousFastPathLayout = FastPathLayout{};
 }
 
 void LinedFlowLayout::ResetSizedLines()
@@ -7844,6 +8183,12 @@ bool LinedFlowLayout::UsesFastPathLayout() const
     return UsesArrangeWidthInfo() && m_itemsInfoFirstIndex == -1;
 }
 
+// Returns True when m_lineFirstItemIndexes reflects the m_lineItemCounts vector populated by ComputeItemsLayoutFastPath.
+bool LinedFlowLayout::UsesLineFirstItemIndexes() const
+{
+    return UsesFastPathLayout() && m_lineFirstItemIndexes.size() == m_lineItemCounts.size() + 1;
+}
+
 #ifdef DBG
 
 winrt::hstring LinedFlowLayout::DependencyPropertyToStringDbg(
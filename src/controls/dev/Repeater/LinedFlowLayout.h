@@ -28,6 +28,13 @@ public:
 
 #pragma region ILayoutOverrides
     winrt::ItemCollectionTransitionProvider CreateDefaultItemTransitionProvider() override;
+    bool TryGetAdjacentItemIndex(
+        winrt::VirtualizingLayoutContext const& context,
+        int itemIndex,
+        winrt::Rect const& itemRect,
+        winrt::FocusNavigationDirection const& focusNavigationDirection,
+        float referenceOffset,
+        int* adjacentItemIndex) override;
 #pragma endregion
 
 #pragma region IVirtualizingLayoutOverrides
@@ -249,6 +256,25 @@ private:
         int m_bestEqualizingTailLineIndex{};
     };
 
+    // Outcome of the last ComputeItemsLayoutFastPath call along with the inputs it was computed from.
+    // The next call compares them to the new inputs and only re-flows the lines affected by the changed items.
+    struct FastPathLayout
+    {
+    public:
+        winrt::com_array<double> m_itemsInfoDesiredAspectRatios{};
+        winrt::com_array<double> m_itemsInfoMinWidths{};
+        winrt::com_array<double> m_itemsInfoMaxWidths{};
+        std::vector<float> m_arrangeWidths{};
+        std::vector<float> m_lineWidths{};
+        double m_itemsInfoMinWidth{ -1.0 };
+        double m_itemsInfoMaxWidth{ -1.0 };
+        double m_actualLineHeight{};
+        double m_averageAspectRatio{};
+        float m_availableWidth{};
+        float m_minItemSpacing{};
+        bool m_itemsAreStretched{};
+    };
+
     // Constants
     static constexpr std::wstring_view s_cannotShareLinedFlowLayout{ L"LinedFlowLayout cannot be shared."sv };
     static constexpr int s_measureCountdownStart{ 5 };
@@ -415,6 +441,11 @@ private:
 
     void ExitRegularPath();
 
+    bool FastPathItemsInfoMatches(
+        FastPathLayout const& previousLayout,
+        int itemIndex,
+        int previousItemIndex) const;
+
     double GetArrangeWidth(
         double desiredAspectRatio,
         double minWidth,
@@ -729,6 +760,7 @@ private:
 
     bool UsesArrangeWidthInfo() const;
     bool UsesFastPathLayout() const;
+    bool UsesLineFirstItemIndexes() const;
 
 #ifdef DBG
     static winrt::hstring DependencyPropertyToStringDbg(
@@ -776,6 +808,11 @@ private:
     std::vector<int> m_lineItemCounts;
     std::vector<float> m_itemsInfoArrangeWidths;
 
+    // Fast path only: index of the first item of each line in m_lineItemCounts, followed by m_itemCount.
+    // Allows binary searches for the line owning an item instead of walking m_lineItemCounts.
+    std::vector<int> m_lineFirstItemIndexes;
+    FastPathLayout m_previousFastPathLayout;
+
     // Items info collected through the ItemsInfoRequested event:
     // - Used only by the regular path layout:
     std::vector<double> m_itemsInfoDesiredAspectRatiosForRegularPath;
@@ -793,7 +830,8 @@ private:
     // is stitched together in those vectors. This allows to only request information for a fraction of the sized items belonging to 5 viewports
     // in each ItemsInfoRequested event.
     // The fast path is only using cheaper temporary winrt::com_array<double> arrays because no such stitching is performed. Information is gathered for
-    // the entire source collection and the arrays are discarded at the end of the measure path.
+    // the entire source collection and the arrays are moved into m_previousFastPathLayout at the end of the measure path, so that the next
+    // ItemsInfoRequested occurrence can be compared to them.
     
     // This countdown is used during initial loading in order to clamp the average aspect ratio between
     // 2/3 and 3/2 to avoid extranuous item realizations while the first items are still unpopulated.
@@ -0,0 +1,190 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "pch.h"
+#include "MeasuredElementSizes.h"
+
+void MeasuredElementSizes::Reset(int count)
+{
+    MUX_ASSERT(count >= 0);
+
+    m_sizes.assign(count, -1.0f);
+    m_sizeTree.assign(count + 1, 0.0);
+    m_measuredTree.assign(count + 1, 0);
+    m_areTreesValid = true;
+    m_totalMeasuredSize = 0.0;
+    m_measuredCount = 0;
+}
+
+void MeasuredElementSizes::SetSize(int index, double size)
+{
+    MUX_ASSERT(index >= 0 && index < Count());
+    MUX_ASSERT(size >= 0.0);
+
+    const float oldSize = m_sizes[index];
+    const float newSize = static_cast<float>(size);
+
+    if (oldSize < 0.0f)
+    {
+        Add(index, newSize, 1);
+    }
+    else if (oldSize != newSize)
+    {
+        Add(index, static_cast<double>(newSize) - oldSize, 0);
+    }
+
+    m_sizes[index] = newSize;
+}
+
+void MeasuredElementSizes::ClearSize(int index)
+{
+    MUX_ASSERT(index >= 0 && index < Count());
+
+    const float oldSize = m_sizes[index];
+    if (oldSize >= 0.0f)
+    {
+        Add(index, -static_cast<double>(oldSize), -1);
+        m_sizes[index] = -1.0f;
+    }
+}
+
+void MeasuredElementSizes::OnItemsInserted(int index, int count)
+{
+    MUX_ASSERT(index >= 0 && index <= Count());
+
+    if (count > 0)
+    {
+        m_sizes.insert(m_sizes.begin() + index, count, -1.0f);
+        m_areTreesValid = false;
+    }
+}
+
+void MeasuredElementSizes::OnItemsRemoved(int index, int count)
+{
+    MUX_ASSERT(index >= 0 && index + count <= Count());
+
+    if (count > 0)
+    {
+        for (int i = index; i < index + count; i++)
+        {
+            const float size = m_sizes[i];
+            if (size >= 0.0f)
+            {
+                m_totalMeasuredSize -= size;
+                m_measuredCount--;
+            }
+        }
+
+        m_sizes.erase(m_sizes.begin() + index, m_sizes.begin() + index + count);
+        m_areTreesValid = false;
+    }
+}
+
+double MeasuredElementSizes::GetOffset(int index, double estimatedSize, double spacing) const
+{
+    MUX_ASSERT(index >= 0 && index <= Count());
+
+    EnsureTrees();
+
+    double measuredSize = 0.0;
+    int measuredCount = 0;
+
+    for (int i = index; i > 0; i -= (i & -i))
+    {
+        measuredSize += m_sizeTree[i];
+        measuredCount += m_measuredTree[i];
+    }
+
+    return measuredSize + (index - measuredCount) * estimatedSize + index * spacing;
+}
+
+int MeasuredElementSizes::GetIndexAt(double offset, double estimatedSize, double spacing) const
+{
+    const int count = Count();
+    if (count == 0)
+    {
+        return -1;
+    }
+
+    EnsureTrees();
+
+    // Standard Fenwick descent: every node covers a power-of-two run of items whose
+    // total slot size is non-negative, so the prefix offsets are monotonic.
+    int position = 0;
+    double accumulated = 0.0;
+    int step = 1;
+    while ((step << 1) <= count)
+    {
+        step <<= 1;
+    }
+
+    for (; step > 0; step >>= 1)
+    {
+        const int next = position + step;
+        if (next <= count)
+        {
+            const double nodeOffset =
+                m_sizeTree[next] + (step - m_measuredTree[next]) * estimatedSize + step * spacing;
+            if (accumulated + nodeOffset <= offset)
+            {
+                position = next;
+                accumulated += nodeOffset;
+            }
+        }
+    }
+
+    // 'position' items end at or before 'offset', so the next one contains it.
+    return std::min(position, count - 1);
+}
+
+void MeasuredElementSizes::Add(int index, double size, int measured)
+{
+    m_totalMeasuredSize += size;
+    m_measuredCount += measured;
+
+    // Stale trees pick the new size up from m_sizes when they are rebuilt.
+    if (!m_areTreesValid)
+    {
+        return;
+    }
+
+    const int count = Count();
+    for (int i = index + 1; i <= count; i += (i & -i))
+    {
+        m_sizeTree[i] += size;
+        m_measuredTree[i] += measured;
+    }
+}
+
+void MeasuredElementSizes::EnsureTrees() const
+{
+    if (m_areTreesValid)
+    {
+        return;
+    }
+
+    const int count = Count();
+
+    m_sizeTree.assign(count + 1, 0.0);
+    m_measuredTree.assign(count + 1, 0);
+
+    // Linear-time construction: seed each node with its own item, then push it to its parent.
+    for (int i = 1; i <= count; i++)
+    {
+        const float size = m_sizes[i - 1];
+        if (size >= 0.0f)
+        {
+            m_sizeTree[i] += size;
+            m_measuredTree[i] += 1;
+        }
+
+        const int parent = i + (i & -i);
+        if (parent <= count)
+        {
+            m_sizeTree[parent] += m_sizeTree[i];
+            m_measuredTree[parent] += m_measuredTree[i];
+        }
+    }
+
+    m_areTreesValid = true;
+}
@@ -0,0 +1,46 @@
+﻿// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+// Records the major size of every element ever measured, indexed by item index.
+// Two Fenwick trees (sizes and counts of measured items) give O(log n) prefix offsets
+// and offset-to-index queries. Inserting or removing items only marks the trees stale;
+// they are rebuilt once, in O(n), before the next offset query. Items that were never
+// measured are filled with an estimated size supplied by the caller at query time.
+class MeasuredElementSizes
+{
+public:
+    int Count() const { return static_cast<int>(m_sizes.size()); }
+    int MeasuredCount() const { return m_measuredCount; }
+    double TotalMeasuredSize() const { return m_totalMeasuredSize; }
+    bool IsMeasured(int index) const { return m_sizes[index] >= 0.0f; }
+
+    void Reset(int count);
+    void SetSize(int index, double size);
+    void ClearSize(int index);
+
+    void OnItemsInserted(int index, int count);
+    void OnItemsRemoved(int index, int count);
+
+    // Major offset of the start of item 'index' (index == Count() gives the end of the
+    // last item), counting 'spacing' after every item before it.
+    double GetOffset(int index, double estimatedSize, double spacing) const;
+
+    // Index of the item whose slot (size plus trailing spacing) contains 'offset'.
+    // Offsets before the first item map to 0, past the last item to Count() - 1.
+    int GetIndexAt(double offset, double estimatedSize, double spacing) const;
+
+private:
+    void Add(int index, double size, int measured);
+    void EnsureTrees() const;
+
+    // Element sizes, negative for items that have not been measured yet.
+    std::vector<float> m_sizes{};
+    // 1-based Fenwick trees over m_sizes, valid only while m_areTreesValid is set.
+    mutable std::vector<double> m_sizeTree{};
+    mutable std::vector<int> m_measuredTree{};
+    mutable bool m_areTreesValid{ true };
+    double m_totalMeasuredSize{};
+    int m_measuredCount{};
+};
@@ -10,13 +10,6 @@
 #include "ItemsRepeater.h"
 #include "Phaser.h"
 
-ElementInfo::ElementInfo(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo) :
-    m_element(element),
-    m_virtInfo(virtInfo)
-{
-    ITEMSREPEATER_TRACE_VERBOSE_DBG(nullptr, TRACE_MSG_METH_INT, METH_NAME, this, virtInfo->Index());
-}
-
 Phaser::Phaser(ItemsRepeater* owner) :
     m_owner(owner)
 {
@@ -69,9 +62,15 @@ void Phaser::PhaseElement(
 
     if (shouldPhase)
     {
-        // Insert at the top since we remove from bottom during DoPhasedWorkCallback. This keeps the ordering of items
-        // the same as the order in which items are realized.
-        m_pendingElements.insert(m_pendingElements.begin(), ElementInfo(element, virtInfo));
+        if (virtInfo->PhasingSlot() != -1)
+        {
+            RemoveFromPending(virtInfo->PhasingSlot());
+        }
+
+        // The element is classified in the next callback, once it has been arranged. Buckets are FIFO which keeps
+        // the ordering of items the same as the order in which items are realized.
+        const int slot = AddToPending(element, virtInfo);
+        LinkToBucket(slot, Visibility::Unclassified, virtInfo->Phase(), false /* atFront */);
         RegisterForCallback();
     }
 }
@@ -80,14 +79,12 @@ void Phaser::StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<V
 {
     // We need to remove the element from the pending elements list. We cannot just change the phase to -1
     // since it will get updated when the element gets recycled.
-    if (virtInfo->DataTemplateComponent())
-    {
-        auto it = std::find_if(m_pendingElements.begin(), m_pendingElements.end(), [&element](const ElementInfo& info) { return info.Element() == element; });
+    const int slot = virtInfo->PhasingSlot();
 
-        if (it != m_pendingElements.end())
-        {
-            m_pendingElements.erase(it);
-        }
+    if (slot != -1)
+    {
+        MUX_ASSERT(m_pendingElements[slot].element == element);
+        RemoveFromPending(slot);
     }
 
     // Clean Phasing information for this item.
@@ -98,17 +95,20 @@ void Phaser::DoPhasedWorkCallback()
 {
     MarkCallbackRecieved();
 
-    if (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield())
+    if (m_pendingCount > 0 && !BuildTreeScheduler::ShouldYield())
     {
-        const auto visibleWindow = m_owner->VisibleWindow();
-        SortElements(visibleWindow);
-        int currentIndex = static_cast<int>(m_pendingElements.size()) - 1;
+        ClassifyElements(m_owner->VisibleWindow());
+
         do
         {
-            const auto info = m_pendingElements[currentIndex];
-            const auto element = info.Element();
-            const auto virtInfo = info.VirtInfo();
-            const auto dataIndex = virtInfo->Index();
+            // Elements in the visible window first, lowest phase first.
+            const int slot = GetNextSlot();
+            MUX_ASSERT(slot != -1);
+
+            // Copies, since the bindings may call back into the repeater and change the pending elements.
+            const auto element = m_pendingElements[slot].element;
+            const auto virtInfo = m_pendingElements[slot].virtInfo;
+            const auto visibility = m_pendingElements[slot].visibility;
 
             const int currentPhase = virtInfo->Phase();
             if (currentPhase > 0)
@@ -120,52 +120,30 @@ void Phaser::DoPhasedWorkCallback()
                 const auto previousAvailableSize = winrt::LayoutInformation::GetAvailableSize(element);
                 element.Measure(previousAvailableSize);
 
-                if (nextPhase > 0)
+                if (virtInfo->PhasingSlot() == slot)
                 {
-                    virtInfo->Phase(nextPhase);
-                    // If we are the first item or 
-                    // If the current items phase is higher than the next items phase, then move to the next item.
-                    if (currentIndex == 0 ||
-                        virtInfo->Phase() > m_pendingElements[currentIndex - 1].VirtInfo()->Phase())
+                    if (nextPhase > 0)
                     {
-                        currentIndex--;
+                        virtInfo->Phase(nextPhase);
+                        // Move to the front of its next phase bucket so the element keeps being phased while no other
+                        // element has a lower phase.
+                        UnlinkFromBucket(slot);
+                        LinkToBucket(slot, visibility, nextPhase, true /* atFront */);
+                    }
+                    else
+                    {
+                        RemoveFromPending(slot);
                     }
-                }
-                else
-                {
-                    m_pendingElements.erase(m_pendingElements.begin() + currentIndex);
-                    currentIndex--;
                 }
             }
             else
             {
                 throw winrt::hresult_error(E_FAIL, L"Cleared element found in pending list which is not expected");
             }
-
-            const auto pendingCount = static_cast<int>(m_pendingElements.size());
-            if (currentIndex == -1)
-            {
-                // Reached the top, start from the bottom again
-                currentIndex = pendingCount - 1;
-            }
-            else if (currentIndex > -1 && currentIndex < pendingCount - 1)
-            {
-                // If the next element is oustide the visible window and there are elements in the visible window
-                // go back to the visible window.
-                bool nextItemIsVisible = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[currentIndex].VirtInfo()->ArrangeBounds());
-                if (!nextItemIsVisible)
-                {
-                    bool haveVisibleItems = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[pendingCount - 1].VirtInfo()->ArrangeBounds());
-                    if (haveVisibleItems)
-                    {
-                        currentIndex = pendingCount - 1;
-                    }
-                }
-            }
-        } while (!m_pendingElements.empty() && !BuildTreeScheduler::ShouldYield());
+        } while (m_pendingCount > 0 && !BuildTreeScheduler::ShouldYield());
     }
 
-    if (!m_pendingElements.empty())
+    if (m_pendingCount > 0)
     {
         RegisterForCallback();
     }
@@ -175,10 +153,10 @@ void Phaser::RegisterForCallback()
 {
     if (!m_registeredForCallback)
     {
-        MUX_ASSERT(!m_pendingElements.empty());
+        MUX_ASSERT(m_pendingCount > 0);
         m_registeredForCallback = true;
         BuildTreeScheduler::RegisterWork(
-            m_pendingElements[m_pendingElements.size() - 1].VirtInfo()->Phase(), // Use the phase of the last one in the sorted list
+            m_pendingElements[GetNextSlot()].virtInfo->Phase(), // Use the phase of the element phased first
             [this]()
         {
             DoPhasedWorkCallback();
@@ -201,34 +179,170 @@ void Phaser::ValidatePhaseOrdering(int currentPhase, int nextPhase)
     }
 }
 
-void Phaser::SortElements(const winrt::Rect& visibleWindow)
+// Sorts the unclassified elements into the Visible/NotVisible buckets. The classified elements are only revisited when the
+// visible window moved since they were classified.
+void Phaser::ClassifyElements(const winrt::Rect& visibleWindow)
 {
-    // Sort in descending order (inVisibleWindow, phase)
-    std::sort(
-        m_pendingElements.begin(),
-        m_pendingElements.end(),
-        [visibleWindow](const auto& lhs, const auto& rhs)
-    {
-        const auto lhsBounds = lhs.VirtInfo()->ArrangeBounds();
-        const auto lhsIntersects = SharedHelpers::DoRectsIntersect(lhsBounds, visibleWindow);
-        const auto rhsBounds = rhs.VirtInfo()->ArrangeBounds();
-        const auto rhsIntersects = SharedHelpers::DoRectsIntersect(rhsBounds, visibleWindow);
-
-        if ((lhsIntersects && rhsIntersects) ||
-            (!lhsIntersects && !rhsIntersects))
+    const bool visibleWindowChanged = visibleWindow != m_classifiedVisibleWindow;
+    m_classifiedVisibleWindow = visibleWindow;
+
+    for (const auto visibility : { Visibility::Unclassified, Visibility::Visible, Visibility::NotVisible })
+    {
+        if (visibility != Visibility::Unclassified && !visibleWindowChanged)
+        {
+            continue;
+        }
+
+        for (auto& entry : m_buckets[static_cast<size_t>(visibility)])
         {
-            // Both are in the visible window or both are not
-            return lhs.VirtInfo()->Phase() < rhs.VirtInfo()->Phase();
+            // Elements moving between Visible and NotVisible are appended to the other visibility's bucket, which may be
+            // walked next. They are then classified the same again and stay in place.
+            const int phase = entry.first;
+            int slot = entry.second.first;
+
+            while (slot != -1)
+            {
+                const int next = m_pendingElements[slot].next;
+                const auto newVisibility = SharedHelpers::DoRectsIntersect(visibleWindow, m_pendingElements[slot].virtInfo->ArrangeBounds()) ?
+                    Visibility::Visible :
+                    Visibility::NotVisible;
+
+                if (newVisibility != visibility)
+                {
+                    UnlinkFromBucket(slot);
+                    LinkToBucket(slot, newVisibility, phase, false /* atFront */);
+                }
+
+                slot = next;
+            }
         }
-        else if (lhsIntersects)
+    }
+}
+
+// Returns the slot of the first element of the lowest phase bucket, for the first visibility with pending elements.
+int Phaser::GetNextSlot() const
+{
+    for (const auto visibility : { Visibility::Visible, Visibility::Unclassified, Visibility::NotVisible })
+    {
+        for (const auto& entry : m_buckets[static_cast<size_t>(visibility)])
         {
-            // Left is in visible window
-            return false;
+            if (entry.second.first != -1)
+            {
+                return entry.second.first;
+            }
+        }
+    }
+
+    return -1;
+}
+
+int Phaser::AddToPending(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo)
+{
+    int slot = m_firstFreeSlot;
+
+    if (slot == -1)
+    {
+        slot = static_cast<int>(m_pendingElements.size());
+        m_pendingElements.emplace_back();
+    }
+    else
+    {
+        m_firstFreeSlot = m_pendingElements[slot].next;
+    }
+
+    auto& pendingElement = m_pendingElements[slot];
+    pendingElement.element = element;
+    pendingElement.virtInfo = virtInfo;
+    virtInfo->PhasingSlot(slot);
+    m_pendingCount++;
+
+    ITEMSREPEATER_TRACE_VERBOSE_DBG(nullptr, TRACE_MSG_METH_INT_INT, METH_NAME, this, virtInfo->Index(), slot);
+
+    return slot;
+}
+
+void Phaser::RemoveFromPending(int slot)
+{
+    UnlinkFromBucket(slot);
+
+    auto& pendingElement = m_pendingElements[slot];
+    pendingElement.virtInfo->PhasingSlot(-1);
+    pendingElement.element = nullptr;
+    pendingElement.virtInfo = nullptr;
+    pendingElement.next = m_firstFreeSlot;
+    m_firstFreeSlot = slot;
+    m_pendingCount--;
+}
+
+void Phaser::LinkToBucket(int slot, Visibility visibility, int phase, bool atFront)
+{
+    auto& bucket = m_buckets[static_cast<size_t>(visibility)][phase];
+    auto& pendingElement = m_pendingElements[slot];
+
+    MUX_ASSERT(pendingElement.bucket == nullptr);
+    pendingElement.bucket = &bucket;
+    pendingElement.visibility = visibility;
+
+    if (atFront)
+    {
+        pendingElement.previous = -1;
+        pendingElement.next = bucket.first;
+
+        if (bucket.first != -1)
+        {
+            m_pendingElements[bucket.first].previous = slot;
         }
         else
         {
-            return true;
+            bucket.last = slot;
         }
+
+        bucket.first = slot;
     }
-    );
+    else
+    {
+        pendingElement.previous = bucket.last;
+        pendingElement.next = -1;
+
+        if (bucket.last != -1)
+        {
+            m_pendingElements[bucket.last].next = slot;
+        }
+        else
+        {
+            bucket.first = slot;
+        }
+
+        bucket.last = slot;
+    }
+}
+
+void Phaser::UnlinkFromBucket(int slot)
+{
+    auto& pendingElement = m_pendingElements[slot];
+    auto bucket = pendingElement.bucket;
+
+    MUX_ASSERT(bucket != nullptr);
+
+    if (pendingElement.previous != -1)
+    {
+        m_pendingElements[pendingElement.previous].next = pendingElement.next;
+    }
+    else
+    {
+        bucket->first = pendingElement.next;
+    }
+
+    if (pendingElement.next != -1)
+    {
+        m_pendingElements[pendingElement.next].previous = pendingElement.previous;
+    }
+    else
+    {
+        bucket->last = pendingElement.previous;
+    }
+
+    pendingElement.bucket = nullptr;
+    pendingElement.previous = -1;
+    pendingElement.next = -1;
 }
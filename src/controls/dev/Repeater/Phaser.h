@@ -5,17 +5,9 @@
 
 class ItemsRepeater;
 
-struct ElementInfo
-{
-    ElementInfo(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
-
-    winrt::UIElement Element() const { return m_element; }
-    winrt::com_ptr<VirtualizationInfo> VirtInfo() const { return m_virtInfo; }
-private:
-    winrt::UIElement m_element{ nullptr };
-    winrt::com_ptr<VirtualizationInfo> m_virtInfo{ nullptr };
-};
-
+// Schedules the x:Phase work of the realized elements. Pending elements are kept in buckets keyed by
+// (visibility, phase) so the next element to phase is found without sorting, and each pending element
+// records its slot on its VirtualizationInfo so it can be removed in constant time when it gets cleared.
 class Phaser final
 {
 public:
@@ -24,13 +16,53 @@ public:
     void StopPhasing(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
 
 private:
+    enum class Visibility
+    {
+        // Added since the last callback, the arrange bounds were not known yet.
+        Unclassified,
+        Visible,
+        NotVisible,
+        Count
+    };
+
+    // Doubly linked list of the pending elements with the same visibility and phase, in the order they were added.
+    struct Bucket
+    {
+        int first{ -1 };
+        int last{ -1 };
+    };
+
+    struct PendingElement
+    {
+        winrt::UIElement element{ nullptr };
+        winrt::com_ptr<VirtualizationInfo> virtInfo{ nullptr };
+        Bucket* bucket{ nullptr };
+        Visibility visibility{ Visibility::Unclassified };
+        int previous{ -1 };
+        // Next element of the bucket, or next free slot when the slot is not used.
+        int next{ -1 };
+    };
+
     void DoPhasedWorkCallback();
     void RegisterForCallback();
     void MarkCallbackRecieved();
-    void SortElements(const winrt::Rect& visibleWindow);
+    void ClassifyElements(const winrt::Rect& visibleWindow);
+    int GetNextSlot() const;
+    int AddToPending(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo);
+    void RemoveFromPending(int slot);
+    void LinkToBucket(int slot, Visibility visibility, int phase, bool atFront);
+    void UnlinkFromBucket(int slot);
     static void ValidatePhaseOrdering(int currentPhase, int nextPhase);
 
     ItemsRepeater* m_owner{ nullptr };
-    std::vector<ElementInfo> m_pendingElements{};
+    // Slots of the pending elements. Unused slots are chained through PendingElement::next.
+    std::vector<PendingElement> m_pendingElements{};
+    int m_firstFreeSlot{ -1 };
+    int m_pendingCount{ 0 };
+    // Buckets for each visibility, by ascending phase. A template only uses a handful of phases, so
+    // empty buckets are kept around rather than freed.
+    std::array<std::map<int, Bucket>, static_cast<size_t>(Visibility::Count)> m_buckets{};
+    // Visible window the Visible/NotVisible buckets were classified against.
+    winrt::Rect m_classifiedVisibleWindow{};
     bool m_registeredForCallback{ false };
 };
@@ -25,6 +25,8 @@ winrt::IVector<winrt::AutomationPeer> RepeaterAutomationPeer::GetChildrenCore()
     const auto childrenPeers = GetInner().as<winrt::IAutomationPeerOverrides>().GetChildrenCore();
     const unsigned peerCount = childrenPeers.Size();
 
+    winrt::get_self<ItemsRepeater>(repeater)->ViewManager().ApplyPendingIndexChanges();
+
     std::vector<std::pair<int /* index */, winrt::AutomationPeer>> realizedPeers;
     realizedPeers.reserve(static_cast<int>(peerCount));
 
@@ -66,7 +66,11 @@ winrt::Size StackLayout::MeasureOverride(
         return {};
     }
 
-    GetAsStackState(context.LayoutState())->OnMeasureStart();
+    const auto stackState = GetAsStackState(context.LayoutState());
+    stackState->OnMeasureStart();
+    stackState->SetUseMeasuredElementSizes(
+        m_estimationMode == winrt::StackLayoutEstimationMode::MeasuredElementSizes,
+        context.ItemCount());
 
     const auto desiredSize = GetFlowAlgorithm(context).Measure(
         availableSize,
@@ -107,8 +111,9 @@ void StackLayout::OnItemsChangedCore(
 {
     if (auto layoutState = context.LayoutState())
     {
-        auto& flow = GetAsStackState(layoutState)->FlowAlgorithm();
-        flow.OnItemsSourceChanged(source, args, context);
+        const auto stackState = GetAsStackState(layoutState);
+        stackState->FlowAlgorithm().OnItemsSourceChanged(source, args, context);
+        stackState->OnItemsSourceChanged(args, context.ItemCount());
     }
     
     // Always invalidate layout to keep the view accurate.
@@ -117,6 +122,45 @@ void StackLayout::OnItemsChangedCore(
 
 #pragma endregion
 
+#pragma region ILayoutOverrides
+
+bool StackLayout::TryGetAdjacentItemIndex(
+    winrt::VirtualizingLayoutContext const& context,
+    int itemIndex,
+    winrt::Rect const& /*itemRect*/,
+    winrt::FocusNavigationDirection const& focusNavigationDirection,
+    float /*referenceOffset*/,
+    int* adjacentItemIndex)
+{
+    *adjacentItemIndex = -1;
+
+    const int itemsCount = context.ItemCount();
+
+    if (itemIndex < 0 || itemIndex >= itemsCount)
+    {
+        return false;
+    }
+
+    const bool isVerticalStack = GetScrollOrientation() == ScrollOrientation::Vertical;
+    const bool isForward = focusNavigationDirection == winrt::FocusNavigationDirection::Down || focusNavigationDirection == winrt::FocusNavigationDirection::Right;
+
+    if (isVerticalStack == (focusNavigationDirection == winrt::FocusNavigationDirection::Up || focusNavigationDirection == winrt::FocusNavigationDirection::Down))
+    {
+        // Moving along the stack: the neighbor is the previous or next item.
+        const int neighborItemIndex = isForward ? itemIndex + 1 : itemIndex - 1;
+
+        if (neighborItemIndex >= 0 && neighborItemIndex < itemsCount)
+        {
+            *adjacentItemIndex = neighborItemIndex;
+        }
+    }
+
+    // Moving across the stack: no item is placed on either side.
+    return true;
+}
+
+#pragma endregion
+
 #pragma region IStackLayoutOverrides
 
 winrt::FlowLayoutAnchorInfo StackLayout::GetAnchorForRealizationRect(
@@ -146,8 +190,19 @@ winrt::FlowLayoutAnchorInfo StackLayout::GetAnchorForRealizationRect(
             // in the navigating direction.
             realizationWindowOffsetInExtent + MajorSize(realizationRect) >= 0 && realizationWindowOffsetInExtent <= majorSize)
         {
-            anchorIndex = (int)(realizationWindowOffsetInExtent / averageElementSize);
-            offset = anchorIndex * averageElementSize + MajorStart(lastExtent);
+            if (UsesMeasuredElementSizes(state))
+            {
+                // Exact offsets for the measured items, the average for the others.
+                const auto& elementSizes = state->ElementSizes();
+                const double estimatedSize = averageElementSize - m_itemSpacing;
+                anchorIndex = elementSizes.GetIndexAt(realizationWindowOffsetInExtent, estimatedSize, m_itemSpacing);
+                offset = elementSizes.GetOffset(anchorIndex, estimatedSize, m_itemSpacing) + MajorStart(lastExtent);
+            }
+            else
+            {
+                anchorIndex = (int)(realizationWindowOffsetInExtent / averageElementSize);
+                offset = anchorIndex * averageElementSize + MajorStart(lastExtent);
+            }
             anchorIndex = std::max(0, std::min(itemsCount - 1, anchorIndex));
         }
     }
@@ -174,16 +229,36 @@ winrt::Rect StackLayout::GetExtent(
     const auto stackState = GetAsStackState(context.LayoutState());
     const double averageElementSize = GetAverageElementSize(availableSize, context, stackState) + m_itemSpacing;
 
+    const bool usesMeasuredElementSizes = UsesMeasuredElementSizes(stackState);
+    const double estimatedSize = averageElementSize - m_itemSpacing;
+
     MinorSize(extent) = static_cast<float>(stackState->MaxArrangeBounds());
-    MajorSize(extent) = std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - m_itemSpacing));
+    MajorSize(extent) = usesMeasuredElementSizes ?
+        std::max(0.0f, static_cast<float>(stackState->ElementSizes().GetOffset(itemsCount, estimatedSize, m_itemSpacing) - m_itemSpacing)) :
+        std::max(0.0f, static_cast<float>(itemsCount * averageElementSize - m_itemSpacing));
     if (itemsCount > 0)
     {
         if (firstRealized)
         {
             MUX_ASSERT(lastRealized);
-            MajorStart(extent) = static_cast<float>(MajorStart(firstRealizedLayoutBounds) - firstRealizedItemIndex * averageElementSize);
-            auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
-            MajorSize(extent) = MajorEnd(lastRealizedLayoutBounds) - MajorStart(extent) + static_cast<float>(remainingItems* averageElementSize);
+            if (usesMeasuredElementSizes)
+            {
+                // The sizes before the first and after the last realized items are the sums of the recorded
+                // sizes, rather than an average that changes as differently sized items get realized.
+                const auto& elementSizes = stackState->ElementSizes();
+                const double sizeBefore = elementSizes.GetOffset(firstRealizedItemIndex, estimatedSize, m_itemSpacing);
+                const double sizeAfter =
+                    elementSizes.GetOffset(itemsCount, estimatedSize, m_itemSpacing) -
+                    elementSizes.GetOffset(lastRealizedItemIndex + 1, estimatedSize, m_itemSpacing);
+                MajorStart(extent) = static_cast<float>(MajorStart(firstRealizedLayoutBounds) - sizeBefore);
+                MajorSize(extent) = MajorEnd(lastRealizedLayoutBounds) - MajorStart(extent) + static_cast<float>(sizeAfter);
+            }
+            else
+            {
+                MajorStart(extent) = static_cast<float>(MajorStart(firstRealizedLayoutBounds) - firstRealizedItemIndex * averageElementSize);
+                auto remainingItems = itemsCount - lastRealizedItemIndex - 1;
+                MajorSize(extent) = MajorEnd(lastRealizedLayoutBounds) - MajorStart(extent) + static_cast<float>(remainingItems* averageElementSize);
+            }
         }
         else
         {
@@ -279,7 +354,14 @@ winrt::FlowLayoutAnchorInfo StackLayout::Algorithm_GetAnchorForTargetElement(
         index = targetIndex;
         const auto state = GetAsStackState(context.LayoutState());
         const double averageElementSize = GetAverageElementSize(availableSize, context, state) + m_itemSpacing;
-        offset = index * averageElementSize + MajorStart(state->FlowAlgorithm().LastExtent());
+        if (UsesMeasuredElementSizes(state))
+        {
+            offset = state->ElementSizes().GetOffset(index, averageElementSize - m_itemSpacing, m_itemSpacing) + MajorStart(state->FlowAlgorithm().LastExtent());
+        }
+        else
+        {
+            offset = index * averageElementSize + MajorStart(state->FlowAlgorithm().LastExtent());
+        }
     }
 
     return winrt::FlowLayoutAnchorInfo{ index, offset };
@@ -345,6 +427,10 @@ void StackLayout::OnPropertyChanged(const winrt::DependencyPropertyChangedEventA
     {
         m_itemSpacing = unbox_value<double>(args.NewValue());
     }
+    else if (property == s_EstimationModeProperty)
+    {
+        m_estimationMode = unbox_value<winrt::StackLayoutEstimationMode>(args.NewValue());
+    }
 
     InvalidateLayout();
 }
@@ -368,7 +454,17 @@ double StackLayout::GetAverageElementSize(
         }
 
         MUX_ASSERT(stackLayoutState->TotalElementsMeasured() > 0);
-        averageElementSize = round(stackLayoutState->TotalElementSize() / stackLayoutState->TotalElementsMeasured());
+
+        const auto& elementSizes = stackLayoutState->ElementSizes();
+        if (UsesMeasuredElementSizes(stackLayoutState) && elementSizes.MeasuredCount() > 0)
+        {
+            // Average over every element measured so far, not just the last BufferSize ones.
+            averageElementSize = round(elementSizes.TotalMeasuredSize() / elementSizes.MeasuredCount());
+        }
+        else
+        {
+            averageElementSize = round(stackLayoutState->TotalElementSize() / stackLayoutState->TotalElementsMeasured());
+        }
     }
 
     return averageElementSize;
@@ -34,6 +34,16 @@ public:
         winrt::NotifyCollectionChangedEventArgs const& args);
 #pragma endregion
 
+#pragma region ILayoutOverrides
+    bool TryGetAdjacentItemIndex(
+        winrt::VirtualizingLayoutContext const& context,
+        int itemIndex,
+        winrt::Rect const& itemRect,
+        winrt::FocusNavigationDirection const& focusNavigationDirection,
+        float referenceOffset,
+        int* adjacentItemIndex) override;
+#pragma endregion
+
 #pragma region IStackLayoutOverrides
     winrt::FlowLayoutAnchorInfo GetAnchorForRealizationRect(
         winrt::Size const& availableSize,
@@ -118,8 +128,14 @@ private:
 
     void UpdateIndexBasedLayoutOrientation(const winrt::Orientation& orientation);
 
+    bool UsesMeasuredElementSizes(const winrt::com_ptr<StackLayoutState>& layoutState) const
+    {
+        return layoutState->UsesMeasuredElementSizes() && layoutState->ElementSizes().Count() > 0;
+    }
+
     // Fields
     double m_itemSpacing{};
+    winrt::StackLayoutEstimationMode m_estimationMode{ winrt::StackLayoutEstimationMode::AverageElementSize };
 
     // !!! WARNING !!!
     // Any storage here needs to be related to layout configuration. 
@@ -41,9 +41,88 @@ void StackLayoutState::OnElementMeasured(int elementIndex, double majorSize, dou
     m_estimationBuffer[estimationBufferIndex] = majorSize;
 
     m_maxArrangeBounds = std::max(m_maxArrangeBounds, minorSize);
+
+    if (m_useMeasuredElementSizes && elementIndex < m_elementSizes.Count())
+    {
+        m_elementSizes.SetSize(elementIndex, majorSize);
+    }
 }
 
 void StackLayoutState::OnMeasureStart()
 {
     m_maxArrangeBounds = 0.0;
 }
+
+void StackLayoutState::SetUseMeasuredElementSizes(bool useMeasuredElementSizes, int itemCount)
+{
+    if (useMeasuredElementSizes)
+    {
+        // The recorded sizes are kept in sync through OnItemsSourceChanged. A count mismatch
+        // means a change was missed, so start over rather than use sizes at the wrong indices.
+        if (!m_useMeasuredElementSizes || m_elementSizes.Count() != itemCount)
+        {
+            m_elementSizes.Reset(itemCount);
+        }
+    }
+    else if (m_useMeasuredElementSizes)
+    {
+        m_elementSizes.Reset(0);
+    }
+
+    m_useMeasuredElementSizes = useMeasuredElementSizes;
+}
+
+void StackLayoutState::OnItemsSourceChanged(const winrt::NotifyCollectionChangedEventArgs& args, int itemCount)
+{
+    if (!m_useMeasuredElementSizes)
+    {
+        return;
+    }
+
+    const auto removeItems = [this, &args]()
+    {
+        const int index = args.OldStartingIndex();
+        const int count = static_cast<int>(args.OldItems().Size());
+        if (index >= 0 && index + count <= m_elementSizes.Count())
+        {
+            m_elementSizes.OnItemsRemoved(index, count);
+        }
+    };
+
+    const auto insertItems = [this, &args]()
+    {
+        const int index = args.NewStartingIndex();
+        if (index >= 0 && index <= m_elementSizes.Count())
+        {
+            m_elementSizes.OnItemsInserted(index, static_cast<int>(args.NewItems().Size()));
+        }
+    };
+
+    switch (args.Action())
+    {
+    case winrt::NotifyCollectionChangedAction::Add:
+        insertItems();
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Remove:
+        removeItems();
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Replace:
+    case winrt::NotifyCollectionChangedAction::Move:
+        // Replaced items need to be measured again, moved items are re-measured when they are realized.
+        removeItems();
+        insertItems();
+        break;
+
+    case winrt::NotifyCollectionChangedAction::Reset:
+        m_elementSizes.Reset(itemCount);
+        break;
+    }
+
+    // Any change that couldn't be applied leaves the count out of sync.
+    if (m_elementSizes.Count() != itemCount)
+    {
+        m_elementSizes.Reset(itemCount);
+    }
+}
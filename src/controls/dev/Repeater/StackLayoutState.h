@@ -5,6 +5,7 @@
 
 #include "StackLayoutState.g.h"
 #include "FlowLayoutAlgorithm.h"
+#include "MeasuredElementSizes.h"
 
 class StackLayoutState :
     public ReferenceTracker<StackLayoutState, winrt::implementation::StackLayoutStateT, winrt::composing>
@@ -17,10 +18,17 @@ public:
     void OnElementMeasured(int elementIndex, double majorSize, double minorSize);
     void OnMeasureStart();
 
+    // Starts or stops recording the size of every measured element, used by
+    // StackLayoutEstimationMode::MeasuredElementSizes.
+    void SetUseMeasuredElementSizes(bool useMeasuredElementSizes, int itemCount);
+    void OnItemsSourceChanged(const winrt::NotifyCollectionChangedEventArgs& args, int itemCount);
+
     ::FlowLayoutAlgorithm& FlowAlgorithm() { return m_flowAlgorithm; }
     double TotalElementSize() const { return m_totalElementSize; }
     double MaxArrangeBounds() const { return m_maxArrangeBounds; }
     int TotalElementsMeasured() const { return m_totalElementsMeasured; }
+    bool UsesMeasuredElementSizes() const { return m_useMeasuredElementSizes; }
+    const MeasuredElementSizes& ElementSizes() const { return m_elementSizes; }
 
 private:
     ::FlowLayoutAlgorithm m_flowAlgorithm{ this };
@@ -31,5 +39,7 @@ private:
     // is going to be used in the calculation of the extent.
     double m_maxArrangeBounds{};
     int m_totalElementsMeasured{};
+    MeasuredElementSizes m_elementSizes{};
+    bool m_useMeasuredElementSizes{ false };
     static const int BufferSize = 100;
 };
@@ -105,6 +105,85 @@ void UniformGridLayout::OnItemsChangedCore(
 }
 #pragma endregion
 
+#pragma region ILayoutOverrides
+
+bool UniformGridLayout::TryGetAdjacentItemIndex(
+    winrt::VirtualizingLayoutContext const& context,
+    int itemIndex,
+    winrt::Rect const& itemRect,
+    winrt::FocusNavigationDirection const& focusNavigationDirection,
+    float referenceOffset,
+    int* adjacentItemIndex)
+{
+    *adjacentItemIndex = -1;
+
+    const int itemsCount = context.ItemCount();
+    const bool isVerticalDirection = focusNavigationDirection == winrt::FocusNavigationDirection::Up || focusNavigationDirection == winrt::FocusNavigationDirection::Down;
+
+    if (itemIndex < 0 || itemIndex >= itemsCount || isVerticalDirection != (GetScrollOrientation() == ScrollOrientation::Vertical))
+    {
+        // Only moves to a neighboring line are supported.
+        return false;
+    }
+
+    // With the remaining justifications the spacing between items depends on the number of items in the line.
+    if (m_itemsJustification != winrt::UniformGridLayoutItemsJustification::Start &&
+        m_itemsJustification != winrt::UniformGridLayoutItemsJustification::Center &&
+        m_itemsJustification != winrt::UniformGridLayoutItemsJustification::End)
+    {
+        return false;
+    }
+
+    const float minorSizeWithSpacing = GetMinorSizeWithSpacing(context);
+
+    if (minorSizeWithSpacing <= 0.0f)
+    {
+        return false;
+    }
+
+    // Same items per line evaluation as in Algorithm_GetExtent, based on the last measure.
+    const float availableSizeMinor = Minor(GetFlowAlgorithm(context).LastAvailableSize());
+    const int itemsPerLine =
+        std::min( // note use of unsigned ints
+            std::max(1u, std::isfinite(availableSizeMinor)
+                ? static_cast<unsigned int>((availableSizeMinor + MinItemSpacing()) / minorSizeWithSpacing)
+                : itemsCount),
+            std::max(1u, m_maximumRowsOrColumns));
+    const int lineIndex = itemIndex / itemsPerLine;
+    const int adjacentLineIndex = (focusNavigationDirection == winrt::FocusNavigationDirection::Down || focusNavigationDirection == winrt::FocusNavigationDirection::Right) ? lineIndex + 1 : lineIndex - 1;
+
+    if (adjacentLineIndex < 0 || adjacentLineIndex > (itemsCount - 1) / itemsPerLine)
+    {
+        return true;
+    }
+
+    // Only the last line can be partially filled. Its items are shifted by the Center and End justifications.
+    const auto getLineItemCount = [itemsPerLine, itemsCount](int line) { return std::min(itemsPerLine, itemsCount - line * itemsPerLine); };
+    const auto getLineShift = [this, itemsPerLine](int lineItemCount)
+    {
+        switch (m_itemsJustification)
+        {
+        case winrt::UniformGridLayoutItemsJustification::Center:
+            return (itemsPerLine - lineItemCount) / 2.0;
+        case winrt::UniformGridLayoutItemsJustification::End:
+            return static_cast<double>(itemsPerLine - lineItemCount);
+        }
+        return 0.0;
+    };
+
+    const int adjacentLineItemCount = getLineItemCount(adjacentLineIndex);
+    const double targetColumn =
+        itemIndex - lineIndex * itemsPerLine +
+        getLineShift(getLineItemCount(lineIndex)) - getLineShift(adjacentLineItemCount) +
+        (referenceOffset - MinorStart(itemRect) - MinorSize(itemRect) / 2.0f) / minorSizeWithSpacing;
+    const int adjacentColumn = std::clamp(static_cast<int>(std::round(targetColumn)), 0, adjacentLineItemCount - 1);
+
+    *adjacentItemIndex = adjacentLineIndex * itemsPerLine + adjacentColumn;
+    return true;
+}
+
+#pragma endregion
+
 #pragma region IFlowLayoutAlgorithmDelegates
 
 winrt::Size UniformGridLayout::Algorithm_GetMeasureSize(int index, const winrt::Size & availableSize, const winrt::VirtualizingLayoutContext& context)
@@ -35,6 +35,16 @@ public:
         winrt::NotifyCollectionChangedEventArgs const& args);
 #pragma endregion
 
+#pragma region ILayoutOverrides
+    bool TryGetAdjacentItemIndex(
+        winrt::VirtualizingLayoutContext const& context,
+        int itemIndex,
+        winrt::Rect const& itemRect,
+        winrt::FocusNavigationDirection const& focusNavigationDirection,
+        float referenceOffset,
+        int* adjacentItemIndex) override;
+#pragma endregion
+
 #pragma region IFlowLayoutAlgorithmDelegates
     winrt::Size Algorithm_GetMeasureSize(int index, const winrt::Size& availableSize, const winrt::VirtualizingLayoutContext& context) override;
     winrt::Size Algorithm_GetProvisionalArrangeSize(int index, const winrt::Size& measureSize, winrt::Size const& desiredSize, const winrt::VirtualizingLayoutContext& context) override;
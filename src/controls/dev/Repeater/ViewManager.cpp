@@ -25,6 +25,8 @@ ViewManager::ViewManager(ItemsRepeater* owner) :
 
 winrt::UIElement ViewManager::GetElement(int index, bool forceCreate, bool suppressAutoRecycle)
 {
+    ApplyPendingIndexChanges();
+
     bool elementIsAnchor = false;
     winrt::UIElement element = forceCreate ? nullptr : GetElementIfAlreadyHeldByLayout(index);
 
@@ -84,6 +86,7 @@ winrt::UIElement ViewManager::GetElement(int index, bool forceCreate, bool suppr
     {
         virtInfo->AutoRecycleCandidate(true);
         virtInfo->KeepAlive(true);
+        m_mayHaveAutoRecycleCandidates = true;
         ITEMSREPEATER_TRACE_INFO_DBG(nullptr, TRACE_MSG_METH_IND_STR_STR_INT, METH_NAME, this, m_owner->Indent(), L"AutoRecycleCandidate", L"virtInfo Index:", virtInfo->Index());
     }
 
@@ -101,6 +104,8 @@ winrt::UIElement ViewManager::GetElement(int index, bool forceCreate, bool suppr
 
 void ViewManager::ClearElement(const winrt::UIElement& element, bool isClearedDueToCollectionChange)
 {
+    ApplyPendingIndexChanges();
+
     const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
     const int index = virtInfo->Index();
     const bool cleared =
@@ -151,6 +156,8 @@ void ViewManager::ClearElement(const winrt::UIElement& element, bool isClearedDu
 // Luckily when we create the items, we store whether we were the once setting the DataContext.
 void ViewManager::ClearElementToElementFactory(const winrt::UIElement& element)
 {
+    ApplyPendingIndexChanges();
+
     m_owner->OnElementClearing(element);
 
     auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
@@ -324,6 +331,8 @@ int ViewManager::GetElementIndex(const winrt::com_ptr<VirtualizationInfo>& virtI
         return -1;
     }
 
+    ApplyPendingIndexChanges();
+
     return virtInfo->IsRealized() || virtInfo->IsInUniqueIdResetPool() ? virtInfo->Index() : -1;
 }
 
@@ -406,42 +415,14 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
     case winrt::NotifyCollectionChangedAction::Add:
     {
         const auto newIndex = args.NewStartingIndex();
-        const auto newCount = args.NewItems().Size();
-        EnsureFirstLastRealizedIndices();
-        if (newIndex <= m_lastRealizedElementIndexHeldByLayout)
+        const auto newCount = static_cast<int>(args.NewItems().Size());
+        if (m_lastRealizedElementIndexHeldByLayout != LastRealizedElementIndexDefault &&
+            newIndex <= m_lastRealizedElementIndexHeldByLayout)
         {
             m_lastRealizedElementIndexHeldByLayout += newCount;
-            auto children = m_owner->Children();
-            const auto childCount = children.Size();
-            for (unsigned i = 0u; i < childCount; ++i)
-            {
-                const auto element = children.GetAt(i);
-                const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-                const auto dataIndex = virtInfo->Index();
-
-                if (virtInfo->IsRealized() && dataIndex >= newIndex)
-                {
-                    UpdateElementIndex(element, virtInfo, dataIndex + newCount);
-                }
-            }
         }
-        else
-        {
-            // Indices held by layout are not affected
-            // We could still have items in the pinned elements that need updates. This is usually a very small vector.
-            for (size_t i = 0; i < m_pinnedPool.size(); ++i)
-            {
-                const auto elementInfo = m_pinnedPool[i];
-                const auto virtInfo = elementInfo.VirtualizationInfo();
-                const auto dataIndex = virtInfo->Index();
 
-                if (virtInfo->IsRealized() && dataIndex >= newIndex)
-                {
-                    auto element = elementInfo.PinnedElement();
-                    UpdateElementIndex(element, virtInfo, dataIndex + newCount);
-                }
-            }
-        }
+        ShiftRealizedIndices(newIndex, newCount);
         break;
     }
 
@@ -478,24 +459,12 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
         {
             // countChange > 0 : countChange items were added
             // countChange < 0 : -countChange  items were removed
-            const auto children = m_owner->Children();
-            for (unsigned i = 0u; i < children.Size(); ++i)
-            {
-                const auto element = children.GetAt(i);
-                const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-                const auto dataIndex = virtInfo->Index();
+            ShiftRealizedIndices(oldStartIndex + oldCount, countChange);
 
-                if (virtInfo->IsRealized())
-                {
-                    if (dataIndex >= oldStartIndex + oldCount)
-                    {
-                        UpdateElementIndex(element, virtInfo, dataIndex + countChange);
-                    }
-                }
+            if (m_lastRealizedElementIndexHeldByLayout != LastRealizedElementIndexDefault)
+            {
+                m_lastRealizedElementIndexHeldByLayout += countChange;
             }
-
-            EnsureFirstLastRealizedIndices();
-            m_lastRealizedElementIndexHeldByLayout += countChange;
         }
         break;
     }
@@ -504,32 +473,44 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
     {
         const auto oldStartIndex = args.OldStartingIndex();
         const auto oldCount = static_cast<int>(args.OldItems().Size());
-        const auto children = m_owner->Children();
-        for (unsigned i = 0u; i < children.Size(); ++i)
+
+        if (m_mayHaveAutoRecycleCandidates)
         {
-            const auto element = children.GetAt(i);
-            const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
-            const auto dataIndex = virtInfo->Index();
+            // The indices must be current to find the candidates whose items were removed.
+            ApplyPendingIndexChanges();
 
-            if (virtInfo->IsRealized())
+            m_mayHaveAutoRecycleCandidates = false;
+
+            const auto children = m_owner->Children();
+            for (unsigned i = 0u; i < children.Size(); ++i)
             {
-                if (virtInfo->AutoRecycleCandidate() && oldStartIndex <= dataIndex && dataIndex < oldStartIndex + oldCount)
-                {
-                    // If we are doing the mapping, remove the element who's data was removed.
-                    m_owner->ClearElementImpl(element);
-                }
-                else if (dataIndex >= (oldStartIndex + oldCount))
+                const auto element = children.GetAt(i);
+                const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+                const auto dataIndex = virtInfo->Index();
+
+                if (virtInfo->IsRealized() && virtInfo->AutoRecycleCandidate())
                 {
-                    UpdateElementIndex(element, virtInfo, dataIndex - oldCount);
+                    if (oldStartIndex <= dataIndex && dataIndex < oldStartIndex + oldCount)
+                    {
+                        // If we are doing the mapping, remove the element who's data was removed.
+                        m_owner->ClearElementImpl(element);
+                    }
+                    else
+                    {
+                        m_mayHaveAutoRecycleCandidates = true;
+                    }
                 }
             }
         }
 
+        ShiftRealizedIndices(oldStartIndex + oldCount, -oldCount);
         InvalidateRealizedIndicesHeldByLayout();
         break;
     }
 
     case winrt::NotifyCollectionChangedAction::Reset:
+        ApplyPendingIndexChanges();
+
         // If we get multiple resets back to back before
         // running layout, we dont have to clear all the elements again.         
         if (!m_isDataSourceStableResetPending)
@@ -562,15 +543,6 @@ void ViewManager::OnItemsSourceChanged(const winrt::IInspectable&, const winrt::
     }
 }
 
-void ViewManager::EnsureFirstLastRealizedIndices()
-{
-    if (m_firstRealizedElementIndexHeldByLayout == FirstRealizedElementIndexDefault)
-    {
-        // This will ensure that the indexes are updated.
-        auto element = GetElementIfAlreadyHeldByLayout(0);
-    }
-}
-
 void ViewManager::OnLayoutChanging()
 {
     if (m_owner->ItemsSourceView() &&
@@ -1021,6 +993,122 @@ void ViewManager::EnsureEventSubscriptions()
     }
 }
 
+void ViewManager::ApplyPendingIndexChanges()
+{
+    m_isPendingMaxRealizedIndexValid = false;
+
+    if (m_pendingIndexShifts.empty())
+    {
+        return;
+    }
+
+    struct IndexChange
+    {
+        winrt::UIElement element;
+        int oldIndex;
+        int newIndex;
+    };
+
+    std::vector<IndexChange> indexChanges;
+    const auto children = m_owner->Children();
+    const unsigned childCount = children.Size();
+
+    m_mayHaveAutoRecycleCandidates = false;
+
+    // All the indices are updated before raising the ElementIndexChanged events, so that handlers see consistent indices.
+    for (unsigned i = 0u; i < childCount; ++i)
+    {
+        const auto element = children.GetAt(i);
+        const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(element);
+
+        if (virtInfo->IsRealized())
+        {
+            const int oldIndex = virtInfo->Index();
+            int newIndex = oldIndex;
+
+            for (const auto& pendingIndexShift : m_pendingIndexShifts)
+            {
+                if (newIndex >= pendingIndexShift.startIndex)
+                {
+                    newIndex += pendingIndexShift.delta;
+                }
+            }
+
+            if (newIndex != oldIndex)
+            {
+                virtInfo->UpdateIndex(newIndex);
+                indexChanges.push_back({ element, oldIndex, newIndex });
+            }
+
+            m_mayHaveAutoRecycleCandidates |= virtInfo->AutoRecycleCandidate();
+        }
+    }
+
+    m_pendingIndexShifts.clear();
+
+    for (const auto& indexChange : indexChanges)
+    {
+        m_owner->OnElementIndexChanged(indexChange.element, indexChange.oldIndex, indexChange.newIndex);
+    }
+}
+
+void ViewManager::ShiftRealizedIndices(int startIndex, int delta)
+{
+    if (delta == 0)
+    {
+        return;
+    }
+
+    if (!m_isPendingMaxRealizedIndexValid)
+    {
+        // The realized indices are current, so the bound starts at the largest of them.
+        MUX_ASSERT(m_pendingIndexShifts.empty());
+        m_isPendingMaxRealizedIndexValid = true;
+        m_pendingMaxRealizedIndex = -1;
+
+        const auto children = m_owner->Children();
+        const unsigned childCount = children.Size();
+        for (unsigned i = 0u; i < childCount; ++i)
+        {
+            const auto virtInfo = ItemsRepeater::GetVirtualizationInfo(children.GetAt(i));
+
+            if (virtInfo->IsRealized())
+            {
+                m_pendingMaxRealizedIndex = std::max(m_pendingMaxRealizedIndex, virtInfo->Index());
+            }
+        }
+    }
+
+    if (startIndex > m_pendingMaxRealizedIndex)
+    {
+        // No realized index moves.
+        return;
+    }
+
+    // Indices just below startIndex don't move, so a shift down can leave one of them as the largest.
+    m_pendingMaxRealizedIndex = (delta > 0) ?
+        m_pendingMaxRealizedIndex + delta :
+        std::max(m_pendingMaxRealizedIndex + delta, startIndex - 1);
+
+    if (!m_pendingIndexShifts.empty() &&
+        m_pendingIndexShifts.back().startIndex == startIndex &&
+        m_pendingIndexShifts.back().delta >= 0)
+    {
+        // The indices moved by the previous shift are still greater than or equal to startIndex, and the other ones are
+        // still lower, so both shifts apply to the same indices.
+        m_pendingIndexShifts.back().delta += delta;
+
+        if (m_pendingIndexShifts.back().delta == 0)
+        {
+            m_pendingIndexShifts.pop_back();
+        }
+    }
+    else
+    {
+        m_pendingIndexShifts.push_back({ startIndex, delta });
+    }
+}
+
 void ViewManager::UpdateElementIndex(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo, int index)
 {
     const auto oldIndex = virtInfo->Index();
@@ -21,6 +21,10 @@ public:
     void ClearElementToElementFactory(const winrt::UIElement& element);
     int GetElementIndex(const winrt::com_ptr<VirtualizationInfo>& virtInfo);
 
+    // Add, Remove and Replace collection changes only record how they shift the realized indices. This applies them
+    // to the realized elements, and must be called before reading their VirtualizationInfo::Index().
+    void ApplyPendingIndexChanges();
+
     void PrunePinnedElements();
     void UpdatePin(const winrt::UIElement& element, bool addPin);
 
@@ -54,9 +58,9 @@ private:
     void EnsureEventSubscriptions();
 
     void UpdateElementIndex(const winrt::UIElement& element, const winrt::com_ptr<VirtualizationInfo>& virtInfo, int index);
+    void ShiftRealizedIndices(int startIndex, int delta);
 
     void InvalidateRealizedIndicesHeldByLayout();
-    void EnsureFirstLastRealizedIndices();
 
     struct PinnedElementInfo
     {
@@ -87,6 +91,26 @@ private:
     tracker_ref<winrt::UIElement> m_lastFocusedElement;
     bool m_isDataSourceStableResetPending{};
 
+    // Shifts of the realized indices by the collection changes since the last ApplyPendingIndexChanges call, in order.
+    // Each one adds delta to the indices greater than or equal to startIndex. Consecutive shifts at the same index are
+    // merged, so inserting items one at a time at the same position keeps a single entry. Shifts past every realized
+    // index, like removing items at the end of the list, are dropped.
+    struct PendingIndexShift
+    {
+        int startIndex;
+        int delta;
+    };
+
+    std::vector<PendingIndexShift> m_pendingIndexShifts;
+
+    // Upper bound of the realized indices once the pending shifts are applied. Elements are only realized or moved after
+    // ApplyPendingIndexChanges, which invalidates it, so it is computed once per batch of collection changes.
+    int m_pendingMaxRealizedIndex{ -1 };
+    bool m_isPendingMaxRealizedIndexValid{};
+
+    // Whether a realized element may be an auto recycle candidate, which must be cleared right away when its item is removed.
+    bool m_mayHaveAutoRecycleCandidates{};
+
     // Event tokens
     winrt::UIElement::GotFocus_revoker m_gotFocus{};
     winrt::UIElement::LostFocus_revoker m_lostFocus{};
@@ -47,6 +47,9 @@ public:
     void Phase(int phase) { m_phase = phase; }
     winrt::IInspectable Data() const { return m_data.get(); }
     winrt::IDataTemplateComponent DataTemplateComponent() const { return m_dataTemplateComponent.get(); }
+    // Handle to the element's entry in the Phaser's pending elements, -1 when it has no pending phase.
+    int PhasingSlot() const { return m_phasingSlot; }
+    void PhasingSlot(int phasingSlot) { m_phasingSlot = phasingSlot; }
 
     bool MustClearDataContext() const { return m_mustClearDataContext; }
     void MustClearDataContext(bool mustClearDataContext) { m_mustClearDataContext = mustClearDataContext; }
@@ -103,6 +106,7 @@ private:
     ElementOwner m_owner{ ElementOwner::ElementFactory };
     winrt::Rect m_arrangeBounds;
     int m_phase{ PhaseNotSpecified };
+    int m_phasingSlot{ -1 };
     bool m_keepAlive{ false };
     bool m_autoRecycleCandidate{ false };
     bool m_mustClearDataContext{ false };
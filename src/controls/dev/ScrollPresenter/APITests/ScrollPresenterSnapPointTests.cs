@@ -275,6 +275,65 @@ namespace Microsoft.UI.Xaml.Tests.MUXControls.ApiTests
             });
         }
 
+        [TestMethod]
+        [TestProperty("Description", "Insert, remove and replace snap points one at a time and ensure the applicable zones match a freshly populated collection.")]
+        public void IncrementalSnapPointChangesUpdateApplicableZones()
+        {
+            const int snapPointCount = 50;
+            ScrollPresenter scrollPresenter1 = null;
+            ScrollPresenter scrollPresenter2 = null;
+            ScrollSnapPoint[] scrollSnapPoints = new ScrollSnapPoint[snapPointCount];
+            ScrollSnapPoint replacementSnapPoint = null;
+
+            RunOnUIThread.Execute(() =>
+            {
+                scrollPresenter1 = new ScrollPresenter();
+                scrollPresenter2 = new ScrollPresenter();
+
+                for (int index = 0; index < snapPointCount; index++)
+                {
+                    scrollSnapPoints[index] = new ScrollSnapPoint(snapPointValue: 10 * index + index % 3, alignment: ScrollSnapPointsAlignment.Near);
+                }
+
+                replacementSnapPoint = new ScrollSnapPoint(snapPointValue: 255, alignment: ScrollSnapPointsAlignment.Near);
+
+                Log.Comment("Inserting snap points in shuffled order into scrollPresenter1");
+                for (int index = 0; index < snapPointCount; index++)
+                {
+                    scrollPresenter1.HorizontalSnapPoints.Insert(
+                        scrollPresenter1.HorizontalSnapPoints.Count / 2,
+                        scrollSnapPoints[(index * 7) % snapPointCount]);
+                }
+
+                Log.Comment("Removing snap points at various positions and replacing one");
+                scrollPresenter1.HorizontalSnapPoints.Remove(scrollSnapPoints[0]);
+                scrollPresenter1.HorizontalSnapPoints.Remove(scrollSnapPoints[snapPointCount - 1]);
+                scrollPresenter1.HorizontalSnapPoints.Remove(scrollSnapPoints[snapPointCount / 2]);
+                scrollPresenter1.HorizontalSnapPoints[scrollPresenter1.HorizontalSnapPoints.IndexOf(scrollSnapPoints[20])] = replacementSnapPoint;
+
+                Log.Comment("Populating scrollPresenter2 with the resulting snap points");
+                foreach (ScrollSnapPointBase scrollSnapPoint in scrollPresenter1.HorizontalSnapPoints)
+                {
+                    scrollPresenter2.HorizontalSnapPoints.Add(scrollSnapPoint);
+                }
+            });
+
+            IdleSynchronizer.Wait();
+
+            RunOnUIThread.Execute(() =>
+            {
+                Verify.AreEqual<int>(snapPointCount - 3, ScrollPresenterTestHooks.GetConsolidatedHorizontalScrollSnapPoints(scrollPresenter1).Count);
+
+                foreach (ScrollSnapPointBase scrollSnapPoint in scrollPresenter2.HorizontalSnapPoints)
+                {
+                    Vector2 applicableZone1 = ScrollPresenterTestHooks.GetHorizontalSnapPointActualApplicableZone(scrollPresenter1, scrollSnapPoint);
+                    Vector2 applicableZone2 = ScrollPresenterTestHooks.GetHorizontalSnapPointActualApplicableZone(scrollPresenter2, scrollSnapPoint);
+
+                    Verify.AreEqual<Vector2>(applicableZone2, applicableZone1);
+                }
+            });
+        }
+
         [TestMethod]
         [TestProperty("Description", "Snap to the first instance of a repeated scroll snap point and ensure it is placed after the Start value.")]
         public void SnapToFirstRepeatedScrollSnapPoint()
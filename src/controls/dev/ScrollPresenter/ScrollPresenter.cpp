@@ -1963,7 +1963,8 @@ void ScrollPresenter::EnsureTransformExpressionAnimations()
 template <typename T>
 void ScrollPresenter::SetupSnapPoints(
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
-    ScrollPresenterDimension dimension)
+    ScrollPresenterDimension dimension,
+    bool updateAllRanges)
 {
     MUX_ASSERT(snapPointsSet);
 
@@ -1992,11 +1993,15 @@ void ScrollPresenter::SetupSnapPoints(
 
         // When snap points are changed while in the Idle State, update
         // ignored snapping values for any potential start of an impulse inertia.
-        UpdateSnapPointsIgnoredValue(snapPointsSet, ignoredValue);
+        updateAllRanges |= UpdateSnapPointsIgnoredValue(snapPointsSet, ignoredValue);
     }
 
-    // Update the regular and impulse actual applicable ranges.
-    UpdateSnapPointsRanges(snapPointsSet, false /*forImpulseOnly*/);
+    if (updateAllRanges)
+    {
+        // Update the regular and impulse actual applicable ranges. When updateAllRanges is False, the caller
+        // already updated the ranges of the snap points neighboring an incremental collection change.
+        UpdateSnapPointsRanges(snapPointsSet, false /*forImpulseOnly*/);
+    }
 
     winrt::Compositor compositor = m_interactionTracker.Compositor();
     winrt::IVector<winrt::InteractionTrackerInertiaModifier> modifiers = winrt::make<Vector<winrt::InteractionTrackerInertiaModifier>>();
@@ -2042,6 +2047,7 @@ void ScrollPresenter::SetupSnapPoints(
     }
     else
     {
+        // Snap points with unchanged applicable zones reuse their previous InertiaModifier.
         for (auto snapPointWrapper : *snapPointsSet)
         {
             winrt::InteractionTrackerInertiaRestingValue modifier = GetInertiaRestingValue(
@@ -2116,6 +2122,27 @@ void ScrollPresenter::UpdateSnapPointsRanges(
     }
 }
 
+// Updates the regular and impulse actual applicable ranges of the snap points in the [first, last) range only.
+// Used after an incremental insertion or removal, which can only affect the ranges of the immediate neighbors.
+template <typename T>
+void ScrollPresenter::UpdateSnapPointsRanges(
+    std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
+    typename std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>::iterator first,
+    typename std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>::iterator last)
+{
+    MUX_ASSERT(snapPointsSet);
+
+    for (auto current = first; current != last; ++current)
+    {
+        const auto next = std::next(current);
+
+        (*current)->DetermineActualApplicableZone(
+            current == snapPointsSet->begin() ? nullptr : std::prev(current)->get(),
+            next == snapPointsSet->end() ? nullptr : next->get(),
+            false /*forImpulseOnly*/);
+    }
+}
+
 template <typename T>
 void ScrollPresenter::UpdateSnapPointsIgnoredValue(
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
@@ -4956,17 +4983,17 @@ void ScrollPresenter::OnScrollControllerAddScrollVelocityRequested(
 
 void ScrollPresenter::OnHorizontalSnapPointsVectorChanged(const winrt::IObservableVector<winrt::ScrollSnapPointBase>& sender, const winrt::IVectorChangedEventArgs args)
 {
-    SnapPointsVectorChangedHelper(sender, args, &m_sortedConsolidatedHorizontalSnapPoints, ScrollPresenterDimension::HorizontalScroll);
+    SnapPointsVectorChangedHelper(sender, args, &m_horizontalSnapPointsCopy, &m_sortedConsolidatedHorizontalSnapPoints, ScrollPresenterDimension::HorizontalScroll);
 }
 
 void ScrollPresenter::OnVerticalSnapPointsVectorChanged(const winrt::IObservableVector<winrt::ScrollSnapPointBase>& sender, const winrt::IVectorChangedEventArgs args)
 {
-    SnapPointsVectorChangedHelper(sender, args, &m_sortedConsolidatedVerticalSnapPoints, ScrollPresenterDimension::VerticalScroll);
+    SnapPointsVectorChangedHelper(sender, args, &m_verticalSnapPointsCopy, &m_sortedConsolidatedVerticalSnapPoints, ScrollPresenterDimension::VerticalScroll);
 }
 
 void ScrollPresenter::OnZoomSnapPointsVectorChanged(const winrt::IObservableVector<winrt::ZoomSnapPointBase>& sender, const winrt::IVectorChangedEventArgs args)
 {
-    SnapPointsVectorChangedHelper(sender, args, &m_sortedConsolidatedZoomSnapPoints, ScrollPresenterDimension::ZoomFactor);
+    SnapPointsVectorChangedHelper(sender, args, &m_zoomSnapPointsCopy, &m_sortedConsolidatedZoomSnapPoints, ScrollPresenterDimension::ZoomFactor);
 }
 
 template <typename T>
@@ -4991,10 +5018,12 @@ template <typename T>
 void ScrollPresenter::SnapPointsVectorChangedHelper(
     winrt::IObservableVector<T> const& snapPoints,
     winrt::IVectorChangedEventArgs const& args,
+    std::vector<T>* snapPointsCopy,
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
     ScrollPresenterDimension dimension)
 {
     MUX_ASSERT(snapPoints);
+    MUX_ASSERT(snapPointsCopy);
     MUX_ASSERT(snapPointsSet);
 
     T insertedItem = nullptr;
@@ -5043,26 +5072,76 @@ void ScrollPresenter::SnapPointsVectorChangedHelper(
         }
     }
 
+    const uint32_t index = args.Index();
+    bool regenerateSnapPointsSet = false;
+
+    // Insertions, removals and replacements are applied incrementally to the consolidated set, so that only
+    // the applicable zones and InertiaModifiers of the neighboring snap points get updated.
     switch (collectionChange)
     {
     case winrt::CollectionChange::ItemInserted:
     {
         if (!insertedItem)
         {
-            insertedItem = snapPoints.GetAt(args.Index());
+            insertedItem = snapPoints.GetAt(index);
         }
 
-        std::shared_ptr<SnapPointWrapper<T>> insertedSnapPointWrapper =
-            std::make_shared<SnapPointWrapper<T>>(insertedItem);
-
-        SnapPointsVectorItemInsertedHelper(insertedSnapPointWrapper, snapPointsSet);
+        if (index <= snapPointsCopy->size())
+        {
+            snapPointsCopy->insert(snapPointsCopy->begin() + index, insertedItem);
+            SnapPointsVectorItemInsertedIncrementallyHelper(insertedItem, snapPointsSet);
+        }
+        else
+        {
+            MUX_ASSERT(false);
+            regenerateSnapPointsSet = true;
+        }
         break;
     }
-    case winrt::CollectionChange::Reset:
     case winrt::CollectionChange::ItemRemoved:
+    {
+        if (index < snapPointsCopy->size())
+        {
+            const T removedItem = (*snapPointsCopy)[index];
+
+            snapPointsCopy->erase(snapPointsCopy->begin() + index);
+            regenerateSnapPointsSet = !SnapPointsVectorItemRemovedIncrementallyHelper(removedItem, snapPointsSet);
+        }
+        else
+        {
+            MUX_ASSERT(false);
+            regenerateSnapPointsSet = true;
+        }
+        break;
+    }
     case winrt::CollectionChange::ItemChanged:
     {
-        RegenerateSnapPointsSet(snapPoints, snapPointsSet);
+        if (index < snapPointsCopy->size())
+        {
+            const T removedItem = (*snapPointsCopy)[index];
+            const T changedItem = snapPoints.GetAt(index);
+
+            (*snapPointsCopy)[index] = changedItem;
+
+            if (SnapPointsVectorItemRemovedIncrementallyHelper(removedItem, snapPointsSet))
+            {
+                SnapPointsVectorItemInsertedIncrementallyHelper(changedItem, snapPointsSet);
+            }
+            else
+            {
+                regenerateSnapPointsSet = true;
+            }
+        }
+        else
+        {
+            MUX_ASSERT(false);
+            regenerateSnapPointsSet = true;
+        }
+        break;
+    }
+    case winrt::CollectionChange::Reset:
+    {
+        regenerateSnapPointsSet = true;
         break;
     }
     default:
@@ -5070,18 +5149,31 @@ void ScrollPresenter::SnapPointsVectorChangedHelper(
         break;
     }
 
-    SetupSnapPoints(snapPointsSet, dimension);
+    if (regenerateSnapPointsSet)
+    {
+        snapPointsCopy->clear();
+        for (T snapPoint : snapPoints)
+        {
+            snapPointsCopy->push_back(snapPoint);
+        }
+
+        RegenerateSnapPointsSet(snapPoints, snapPointsSet);
+    }
+
+    SetupSnapPoints(snapPointsSet, dimension, regenerateSnapPointsSet /*updateAllRanges*/);
 }
 
+// Adds the provided snap point to the consolidated set, or combines it with an equal snap point already present.
+// Returns True when the snap point was added as a new entry.
 template <typename T>
-void ScrollPresenter::SnapPointsVectorItemInsertedHelper(
+bool ScrollPresenter::SnapPointsVectorItemInsertedHelper(
     std::shared_ptr<SnapPointWrapper<T>> insertedItem,
     std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet)
 {
     if (snapPointsSet->empty())
     {
         snapPointsSet->insert(insertedItem);
-        return;
+        return true;
     }
 
     winrt::SnapPointBase winrtInsertedItem = insertedItem->SnapPoint().as<winrt::SnapPointBase>();
@@ -5095,7 +5187,7 @@ void ScrollPresenter::SnapPointsVectorItemInsertedHelper(
         if (*lowerSnapPoint == winrt::get_self<SnapPointBase>(winrtInsertedItem))
         {
             (*lowerBound)->Combine(insertedItem.get());
-            return;
+            return false;
         }
         lowerBound++;
     }
@@ -5107,10 +5199,60 @@ void ScrollPresenter::SnapPointsVectorItemInsertedHelper(
         if (*upperSnapPoint == winrt::get_self<SnapPointBase>(winrtInsertedItem))
         {
             (*lowerBound)->Combine(insertedItem.get());
-            return;
+            return false;
         }
     }
     snapPointsSet->insert(insertedItem);
+    return true;
+}
+
+// Adds the provided snap point to the consolidated set and updates the applicable ranges of the new entry and
+// its two neighbors. A snap point combined with an existing entry does not affect any range.
+template <typename T>
+void ScrollPresenter::SnapPointsVectorItemInsertedIncrementallyHelper(
+    T const& insertedItem,
+    std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet)
+{
+    std::shared_ptr<SnapPointWrapper<T>> insertedSnapPointWrapper =
+        std::make_shared<SnapPointWrapper<T>>(insertedItem);
+
+    if (SnapPointsVectorItemInsertedHelper(insertedSnapPointWrapper, snapPointsSet))
+    {
+        const auto inserted = snapPointsSet->find(insertedSnapPointWrapper);
+
+        MUX_ASSERT(inserted != snapPointsSet->end());
+
+        const auto first = inserted == snapPointsSet->begin() ? inserted : std::prev(inserted);
+        const auto next = std::next(inserted);
+        const auto last = next == snapPointsSet->end() ? next : std::next(next);
+
+        UpdateSnapPointsRanges(snapPointsSet, first, last);
+    }
+}
+
+// Removes the provided snap point from the consolidated set and updates the applicable ranges of its two former
+// neighbors. Returns False when the snap point was combined with others, in which case the caller needs to
+// regenerate the whole set since a combination cannot be undone.
+template <typename T>
+bool ScrollPresenter::SnapPointsVectorItemRemovedIncrementallyHelper(
+    T const& removedItem,
+    std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet)
+{
+    const auto removed = snapPointsSet->lower_bound(std::make_shared<SnapPointWrapper<T>>(removedItem));
+
+    if (removed == snapPointsSet->end() ||
+        (*removed)->SnapPoint() != removedItem ||
+        (*removed)->CombinationCount() != 0)
+    {
+        return false;
+    }
+
+    const auto next = snapPointsSet->erase(removed);
+    const auto first = next == snapPointsSet->begin() ? next : std::prev(next);
+    const auto last = next == snapPointsSet->end() ? next : std::next(next);
+
+    UpdateSnapPointsRanges(snapPointsSet, first, last);
+    return true;
 }
 
 template <typename T>
@@ -5380,7 +5522,7 @@ void ScrollPresenter::UpdateUnzoomedExtentAndViewport(
         MUX_ASSERT(horizontalSnapPointsNeedViewportUpdates);
 
         RegenerateSnapPointsSet(horizontalSnapPoints, &m_sortedConsolidatedHorizontalSnapPoints);
-        SetupSnapPoints(&m_sortedConsolidatedHorizontalSnapPoints, ScrollPresenterDimension::HorizontalScroll);
+        SetupSnapPoints(&m_sortedConsolidatedHorizontalSnapPoints, ScrollPresenterDimension::HorizontalScroll, true /*updateAllRanges*/);
     }
 
     if (verticalViewportChanged && m_verticalSnapPoints && m_verticalSnapPointsNeedViewportUpdates)
@@ -5394,7 +5536,7 @@ void ScrollPresenter::UpdateUnzoomedExtentAndViewport(
         MUX_ASSERT(verticalSnapPointsNeedViewportUpdates);
 
         RegenerateSnapPointsSet(verticalSnapPoints, &m_sortedConsolidatedVerticalSnapPoints);
-        SetupSnapPoints(&m_sortedConsolidatedVerticalSnapPoints, ScrollPresenterDimension::VerticalScroll);
+        SetupSnapPoints(&m_sortedConsolidatedVerticalSnapPoints, ScrollPresenterDimension::VerticalScroll, true /*updateAllRanges*/);
     }
 
     if (extentChanged)
@@ -6953,6 +7095,12 @@ winrt::InteractionTrackerInertiaRestingValue ScrollPresenter::GetInertiaRestingV
     winrt::hstring const& scale) const
 {
     const bool isInertiaFromImpulse = IsInertiaFromImpulse();
+
+    if (const winrt::InteractionTrackerInertiaRestingValue cachedModifier = snapPointWrapper->GetCachedInertiaRestingValue(isInertiaFromImpulse))
+    {
+        return cachedModifier;
+    }
+
     const winrt::InteractionTrackerInertiaRestingValue modifier = winrt::InteractionTrackerInertiaRestingValue::Create(compositor);
     const winrt::ExpressionAnimation conditionExpressionAnimation = snapPointWrapper->CreateConditionalExpression(m_interactionTracker, target, scale, isInertiaFromImpulse);
     const winrt::ExpressionAnimation restingPointExpressionAnimation = snapPointWrapper->CreateRestingPointExpression(m_interactionTracker, target, scale, isInertiaFromImpulse);
@@ -6960,6 +7108,8 @@ winrt::InteractionTrackerInertiaRestingValue ScrollPresenter::GetInertiaRestingV
     modifier.Condition(conditionExpressionAnimation);
     modifier.RestingValue(restingPointExpressionAnimation);
 
+    snapPointWrapper->SetCachedInertiaRestingValue(modifier, isInertiaFromImpulse);
+
     return modifier;
 }
 
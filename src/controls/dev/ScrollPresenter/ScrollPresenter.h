@@ -341,10 +341,15 @@ private:
     void EnsureTransformExpressionAnimations();
     template <typename T> void SetupSnapPoints(
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
-        ScrollPresenterDimension dimension);
+        ScrollPresenterDimension dimension,
+        bool updateAllRanges);
     template <typename T> void UpdateSnapPointsRanges(
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
         bool forImpulseOnly);
+    template <typename T> void UpdateSnapPointsRanges(
+        std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
+        typename std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>::iterator first,
+        typename std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>::iterator last);
     template <typename T> void UpdateSnapPointsIgnoredValue(
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
         ScrollPresenterDimension dimension);
@@ -678,11 +683,18 @@ private:
     template <typename T> void SnapPointsVectorChangedHelper(
         winrt::IObservableVector<T> const& scrollSnapPoints,
         winrt::IVectorChangedEventArgs const& args,
+        std::vector<T>* snapPointsCopy,
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet,
         ScrollPresenterDimension dimension);
-    template <typename T> void SnapPointsVectorItemInsertedHelper(
+    template <typename T> bool SnapPointsVectorItemInsertedHelper(
         std::shared_ptr<SnapPointWrapper<T>> insertedItem,
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet);
+    template <typename T> void SnapPointsVectorItemInsertedIncrementallyHelper(
+        T const& insertedItem,
+        std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet);
+    template <typename T> bool SnapPointsVectorItemRemovedIncrementallyHelper(
+        T const& removedItem,
+        std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* snapPointsSet);
     template <typename T> void RegenerateSnapPointsSet(
         winrt::IObservableVector<T> const& userVector,
         std::set<std::shared_ptr<SnapPointWrapper<T>>, SnapPointWrapperComparator<T>>* internalSet);
@@ -890,6 +902,11 @@ private:
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> m_sortedConsolidatedHorizontalSnapPoints{};
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ScrollSnapPointBase>>, SnapPointWrapperComparator<winrt::ScrollSnapPointBase>> m_sortedConsolidatedVerticalSnapPoints{};
     std::set<std::shared_ptr<SnapPointWrapper<winrt::ZoomSnapPointBase>>, SnapPointWrapperComparator<winrt::ZoomSnapPointBase>> m_sortedConsolidatedZoomSnapPoints{};
+    // Copies of the HorizontalSnapPoints, VerticalSnapPoints and ZoomSnapPoints collections, used to identify the
+    // snap point removed or replaced by an ItemRemoved or ItemChanged collection change.
+    std::vector<winrt::ScrollSnapPointBase> m_horizontalSnapPointsCopy{};
+    std::vector<winrt::ScrollSnapPointBase> m_verticalSnapPointsCopy{};
+    std::vector<winrt::ZoomSnapPointBase> m_zoomSnapPointsCopy{};
 
     // Maximum difference for offsets to be considered equal. Used for pointer wheel scrolling.
     static constexpr float s_offsetEqualityEpsilon{ 0.00001f };
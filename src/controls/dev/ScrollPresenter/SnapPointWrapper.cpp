@@ -106,9 +106,45 @@ std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> SnapPointWrap
         m_ignoredValue,
         m_actualImpulseApplicableZone);
 
+    if (m_cachedInertiaRestingValue)
+    {
+        // The cached InertiaModifier shares the expression animations updated above.
+        m_cachedActualImpulseApplicableZone = m_actualImpulseApplicableZone;
+        m_cachedIgnoredValue = m_ignoredValue;
+    }
+
     return std::make_tuple(m_conditionExpressionAnimation, m_restingValueExpressionAnimation);
 }
 
+// Returns the InertiaModifier previously built for this snap point when its applicable zones and ignored value
+// have not changed since, and null otherwise.
+template<typename T>
+winrt::InteractionTrackerInertiaRestingValue SnapPointWrapper<T>::GetCachedInertiaRestingValue(bool isInertiaFromImpulse) const
+{
+    if (m_cachedInertiaRestingValue &&
+        m_cachedIsInertiaFromImpulse == isInertiaFromImpulse &&
+        m_cachedActualApplicableZone == m_actualApplicableZone &&
+        m_cachedActualImpulseApplicableZone == m_actualImpulseApplicableZone &&
+        ((isnan(m_cachedIgnoredValue) && isnan(m_ignoredValue)) || m_cachedIgnoredValue == m_ignoredValue))
+    {
+        return m_cachedInertiaRestingValue;
+    }
+
+    return nullptr;
+}
+
+template<typename T>
+void SnapPointWrapper<T>::SetCachedInertiaRestingValue(
+    winrt::InteractionTrackerInertiaRestingValue const& inertiaRestingValue,
+    bool isInertiaFromImpulse)
+{
+    m_cachedInertiaRestingValue = inertiaRestingValue;
+    m_cachedActualApplicableZone = m_actualApplicableZone;
+    m_cachedActualImpulseApplicableZone = m_actualImpulseApplicableZone;
+    m_cachedIgnoredValue = m_ignoredValue;
+    m_cachedIsInertiaFromImpulse = isInertiaFromImpulse;
+}
+
 template<typename T>
 void SnapPointWrapper<T>::DetermineActualApplicableZone(
     const SnapPointWrapper<T>* previousSnapPointWrapper,
@@ -219,6 +255,16 @@ template winrt::ExpressionAnimation SnapPointWrapper<winrt::ZoomSnapPointBase>::
 template std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> SnapPointWrapper<winrt::ScrollSnapPointBase>::GetUpdatedExpressionAnimationsForImpulse();
 template std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> SnapPointWrapper<winrt::ZoomSnapPointBase>::GetUpdatedExpressionAnimationsForImpulse();
 
+template winrt::InteractionTrackerInertiaRestingValue SnapPointWrapper<winrt::ScrollSnapPointBase>::GetCachedInertiaRestingValue(bool isInertiaFromImpulse) const;
+template winrt::InteractionTrackerInertiaRestingValue SnapPointWrapper<winrt::ZoomSnapPointBase>::GetCachedInertiaRestingValue(bool isInertiaFromImpulse) const;
+
+template void SnapPointWrapper<winrt::ScrollSnapPointBase>::SetCachedInertiaRestingValue(
+    winrt::InteractionTrackerInertiaRestingValue const& inertiaRestingValue,
+    bool isInertiaFromImpulse);
+template void SnapPointWrapper<winrt::ZoomSnapPointBase>::SetCachedInertiaRestingValue(
+    winrt::InteractionTrackerInertiaRestingValue const& inertiaRestingValue,
+    bool isInertiaFromImpulse);
+
 template void SnapPointWrapper<winrt::ScrollSnapPointBase>::DetermineActualApplicableZone(
     const SnapPointWrapper<winrt::ScrollSnapPointBase>* previousSnapPoint,
     const SnapPointWrapper<winrt::ScrollSnapPointBase>* nextSnapPoint,
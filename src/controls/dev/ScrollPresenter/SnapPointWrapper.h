@@ -35,6 +35,10 @@ public:
         winrt::hstring const& scale,
         bool isInertiaFromImpulse);
     std::tuple<winrt::ExpressionAnimation, winrt::ExpressionAnimation> GetUpdatedExpressionAnimationsForImpulse();
+    winrt::InteractionTrackerInertiaRestingValue GetCachedInertiaRestingValue(bool isInertiaFromImpulse) const;
+    void SetCachedInertiaRestingValue(
+        winrt::InteractionTrackerInertiaRestingValue const& inertiaRestingValue,
+        bool isInertiaFromImpulse);
     void DetermineActualApplicableZone(
         const SnapPointWrapper<T>* previousSnapPointWrapper,
         const SnapPointWrapper<T>* nextSnapPointWrapper,
@@ -56,6 +60,15 @@ private:
     double m_ignoredValue{ NAN }; // Ignored snapping value when inertia is triggered by an impulse
     winrt::ExpressionAnimation m_conditionExpressionAnimation{ nullptr };
     winrt::ExpressionAnimation m_restingValueExpressionAnimation{ nullptr };
+
+    // InertiaModifier built from m_conditionExpressionAnimation and m_restingValueExpressionAnimation, along with the
+    // inputs it was built with. It is reused by ScrollPresenter::SetupSnapPoints as long as these inputs are unchanged,
+    // so that only the snap points neighboring a collection change get new composition expressions.
+    winrt::InteractionTrackerInertiaRestingValue m_cachedInertiaRestingValue{ nullptr };
+    std::tuple<double, double> m_cachedActualApplicableZone{ -INFINITY, INFINITY };
+    std::tuple<double, double> m_cachedActualImpulseApplicableZone{ -INFINITY, INFINITY };
+    double m_cachedIgnoredValue{ NAN };
+    bool m_cachedIsInertiaFromImpulse{ false };
 };
 
 template <typename T>
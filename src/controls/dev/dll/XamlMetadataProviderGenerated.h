@@ -5473,6 +5473,7 @@ Entry c_typeEntries[] =
                     winrt::IStackLayoutStatics2 statics2 = GetFactory<winrt::IStackLayoutStatics2>(L"Microsoft.UI.Xaml.Controls.StackLayout");
                     {
                         xamlType.AddDPMember(L"DisableVirtualization", L"Boolean", statics2.DisableVirtualizationProperty(), false /* isContent */);
+                        xamlType.AddDPMember(L"EstimationMode", L"Microsoft.UI.Xaml.Controls.StackLayoutEstimationMode", statics2.EstimationModeProperty(), false /* isContent */);
                     }
 
                 });
@@ -5480,6 +5481,26 @@ Entry c_typeEntries[] =
             return static_cast<winrt::IXamlType>(*xamlType);
         }
     },
+    {
+        /* Arg1 TypeName */ 
+        L"Microsoft.UI.Xaml.Controls.StackLayoutEstimationMode",
+        /* Arg2 CreateXamlTypeCallback */ 
+        []()
+        {
+            auto xamlType = winrt::make<EnumXamlType>(
+                /* Arg 1 - TypeName */ 
+                (PCWSTR)L"Microsoft.UI.Xaml.Controls.StackLayoutEstimationMode",
+                /* Arg 2 - CreateFromString func */ 
+                (std::function<winrt::IInspectable(hstring)>)[](hstring fromString)
+                {
+                    if (fromString == L"AverageElementSize") return box_value(winrt::StackLayoutEstimationMode::AverageElementSize);
+                    if (fromString == L"MeasuredElementSizes") return box_value(winrt::StackLayoutEstimationMode::MeasuredElementSizes);
+                    throw winrt::hresult_invalid_argument();
+                });
+
+            return xamlType;
+        }
+    },
     {
         /* Arg1 TypeName */ 
         L"Microsoft.UI.Xaml.Controls.StackLayoutState",
@@ -71,6 +71,10 @@ public:
 
     void SetSortedCollectionDirty(_In_ bool fDirty) { m_fSortedElementsDirty = fDirty; }
 
+    // Repositions a child whose Canvas.ZIndex changed within the sorted render order, or
+    // marks the render order dirty if it can't be updated in place.
+    void OnChildZIndexChanged(_In_ CUIElement* pChild);
+
     // the bool indicates whether we executed extra removal code which indicates this was an element that
     // was unloading.
     _Check_return_ HRESULT RemoveUnloadedElement(_In_ CUIElement* pTarget, UINT unloadContext, _Out_ bool* pfExecutedUnload);
@@ -107,9 +111,34 @@ protected:
 private:
     void OnChildrenChanged(_In_opt_ CDependencyObject *pChildSender);
 
-    bool HasSortedChildren() const { return m_ppSortedUIElements != NULL; }
+    // Draw order key of an entry in the sorted render order. Elements are ordered by ZIndex, then by
+    // their position among the children (or among children and unloading elements, see SortChildren).
+    struct RenderOrderKey
+    {
+        INT32 zIndex;
+        UINT32 order;
+
+        bool operator<(const RenderOrderKey& other) const
+        {
+            return (zIndex != other.zIndex) ? (zIndex < other.zIndex) : (order < other.order);
+        }
+    };
+
+    bool HasSortedChildren() const { return !m_sortedUIElements.empty(); }
 
-    bool NeedsToSort(_In_ const std::vector<CDependencyObject*>& unsortedUIElements) const;
+    // The sorted render order can be patched in place as long as it's up to date and only contains live
+    // children. Orders that include unloading elements are rebuilt instead.
+    bool CanUpdateSortedChildrenInPlace() const
+    {
+        return !m_fSortedElementsDirty && HasSortedChildren() && !m_sortedChildrenIncludeUnloading;
+    }
+
+    void OnChildInsertedForRenderOrder(_In_ XUINT32 nIndex, _In_ CUIElement* pChild);
+    void OnChildRemovedForRenderOrder(_In_ XUINT32 nIndex, _In_opt_ CDependencyObject* pChild);
+    int FindSortedChild(_In_ const CUIElement* pChild) const;
+    int FindSortedChild(_In_ const RenderOrderKey& key, _In_ const CUIElement* pChild) const;
+    void InsertSortedChild(_In_ const RenderOrderKey& key, _In_ CUIElement* pChild);
+    void EraseSortedChild(_In_ size_t position);
 
     void DestroySortedCollection();
     UINT SortChildren(const std::vector<CUIElement*>& additionalElements, bool additionalElementsAboveChildren);
@@ -126,11 +155,18 @@ public:
 private:
     CTransitionRoot*                        m_pLocalTransitionRoot  = nullptr;
 
-    // Array of no-ref pointers to elements in the collection sorted by z-index.
+    // No-ref pointers to elements in the collection sorted by z-index, and their draw order keys.
     // Because this list doesn't hold references, it's not safe to access once the collection is modified.
-    CUIElement**                            m_ppSortedUIElements    = nullptr;
+    // Both buffers are reused across sorts, and patched in place for single child changes.
+    std::vector<CUIElement*>                m_sortedUIElements;
+    std::vector<RenderOrderKey>             m_sortedKeys;
+
+    // Number of entries in m_sortedKeys with a nonzero ZIndex. Once it drops to zero the children are
+    // rendered in their natural order again.
+    UINT32 m_nonZeroZIndexChildCount = 0;
 
     bool m_fSortedElementsDirty = false;
+    bool m_sortedChildrenIncludeUnloading = false;
 
     std::weak_ptr<ICollectionChangeCallback> m_wrChangeCallback;
     std::function<HRESULT(CUIElement*)> m_toolbarAddedCallback;
@@ -165,6 +165,12 @@ CResourceDictionaryCollection::OnRemoveFromCollection(_In_ CDependencyObject *pD
     }
     pDictionary->SetResourceOwner(nullptr);
 
+    if (CResourceDictionary* parentDictionary = do_pointer_cast<CResourceDictionary>(GetParentInternal(false)))
+    {
+        // The dictionaries above may have indexed keys they found in the dictionary we are removing.
+        parentDictionary->InvalidateMergedResourceIndex();
+    }
+
     IFC_RETURN(CDOCollection::OnRemoveFromCollection(pDO, iPreviousIndex));
 
     return S_OK;
@@ -214,6 +220,14 @@ CResourceDictionaryCollection::Clear()
 
     IFC(CDOCollection::Clear());
 
+    if (nCount > 0)
+    {
+        if (CResourceDictionary* parentDictionary = do_pointer_cast<CResourceDictionary>(GetParentInternal(false)))
+        {
+            parentDictionary->InvalidateMergedResourceIndex();
+        }
+    }
+
     if (pOldDictionaries)
     {
         IFC(pOldDictionaries->InvalidateImplicitStyles());
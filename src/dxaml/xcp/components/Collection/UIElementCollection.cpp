@@ -212,13 +212,17 @@ CUIElementCollection::SetOwner(_In_opt_ CDependencyObject *pOwner, _In_opt_ REND
 //------------------------------------------------------------------------
 //
 //  Synopsis:
-//      Clears the sorted element collection.
+//      Clears the sorted element collection. The buffers keep their
+//      capacity so the next sort doesn't need to allocate.
 //
 //------------------------------------------------------------------------
 void
 CUIElementCollection::DestroySortedCollection()
 {
-    SAFE_DELETE_ARRAY(m_ppSortedUIElements);
+    m_sortedUIElements.clear();
+    m_sortedKeys.clear();
+    m_nonZeroZIndexChildCount = 0;
+    m_sortedChildrenIncludeUnloading = false;
 }
 
 //------------------------------------------------------------------------
@@ -244,172 +248,328 @@ CUIElementCollection::GetChildrenInRenderOrderInternal(
 
     UINT uiChildCount = GetCount();
 
-    // A special case is made for unloading storage:
-    // Implicit Hide animations and Connected Animations put elements into unloading storage and also require
-    // the RenderWalk to render these elements.  To accommodate this case, we include these elements in the collection
-    // with the following Z-ordering behaviors:
-    // 1) If this is Panel's collection, we put these elements at the end of the collection (highest in z order).
-    // 2) If this is not a Panel, we put these elements at the beginning of the collection (lowest in z order).
-    //    This is done so that for single child scenarios (eg Page navigation), the outgoing page is lower in z order.
-    // 3) We sort the overall collection so that Canvas.ZIndex can be used to override the default ordering.
-    std::vector<CUIElement*> additionalElements;
-    if (HasUnloadingStorage())
+    if (m_fSortedElementsDirty)
     {
-        for (UIElementCollectionUnloadingStorage::UnloadingMap::const_iterator it = m_pUnloadingStorage->m_unloadingElements.begin(); it != m_pUnloadingStorage->m_unloadingElements.end(); ++it)
+        // A special case is made for unloading storage:
+        // Implicit Hide animations and Connected Animations put elements into unloading storage and also require
+        // the RenderWalk to render these elements.  To accommodate this case, we include these elements in the collection
+        // with the following Z-ordering behaviors:
+        // 1) If this is Panel's collection, we put these elements at the end of the collection (highest in z order).
+        // 2) If this is not a Panel, we put these elements at the beginning of the collection (lowest in z order).
+        //    This is done so that for single child scenarios (eg Page navigation), the outgoing page is lower in z order.
+        // 3) We sort the overall collection so that Canvas.ZIndex can be used to override the default ordering.
+        // Every change to the unloading storage marks the collection dirty, so the result is kept until then.
+        std::vector<CUIElement*> additionalElements;
+        if (HasUnloadingStorage())
         {
-            if ((*(it->second) & UC_REFERENCE_ImplicitAnimation) != 0 ||
-                (*(it->second) & UC_REFERENCE_ConnectedAnimation) != 0)
+            for (UIElementCollectionUnloadingStorage::UnloadingMap::const_iterator it = m_pUnloadingStorage->m_unloadingElements.begin(); it != m_pUnloadingStorage->m_unloadingElements.end(); ++it)
             {
-                additionalElements.push_back(it->first);
+                if ((*(it->second) & UC_REFERENCE_ImplicitAnimation) != 0 ||
+                    (*(it->second) & UC_REFERENCE_ConnectedAnimation) != 0)
+                {
+                    additionalElements.push_back(it->first);
+                }
             }
         }
+
+        if (additionalElements.size() > 0)
+        {
+            bool isParentPanel = GetOwner()->OfTypeByIndex<KnownTypeIndex::Panel>();
+            SortChildren(additionalElements, isParentPanel);
+        }
+        else if (uiChildCount > 1)
+        {
+            //
+            // We're dirty for sorting but we don't know whether we need a sorted
+            // collection. By default we don't need a sorted collection and we render in
+            // the order of the child elements. But if one of the child elements has a
+            // nonzero ZIndex, then SortChildren keeps the sorted order and we render
+            // in sorted order.
+            //
+            SortChildren(additionalElements, true);
+        }
+
+        //
+        // Otherwise there's at most one child so order doesn't matter. The collection
+        // stays dirty so that when a second element is added we check whether sorting
+        // is necessary.
+        //
     }
 
-    if (additionalElements.size() > 0)
+    if (!m_fSortedElementsDirty && HasSortedChildren())
     {
-        bool isParentPanel = GetOwner()->OfTypeByIndex<KnownTypeIndex::Panel>();
-        *puiChildCount = SortChildren(additionalElements, isParentPanel);
-        *pppUIElements = m_ppSortedUIElements;
+        *pppUIElements = m_sortedUIElements.data();
+        *puiChildCount = static_cast<XUINT32>(m_sortedUIElements.size());
     }
-    else
+    else if (uiChildCount > 0)
+    {
+        *pppUIElements = doarray_to_elementarray_cast(GetCollection().data());
+        *puiChildCount = uiChildCount;
+    }
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Builds the sorted collection, sorting by draw order. If there are no
+//      additional elements and no child has a nonzero ZIndex, the sorted
+//      collection is left empty and the children render in natural order.
+//
+//------------------------------------------------------------------------
+UINT CUIElementCollection::SortChildren(
+    const std::vector<CUIElement*>& additionalElements, // Elements to include in addition to the live elements in the collection
+    bool additionalElementsAboveChildren)               // true => position additionalElement above live children, else below
+{
+    UINT liveChildCount = GetCount();
+    UINT additionalChildCount = static_cast<UINT>(additionalElements.size());
+    UINT totalChildCount = liveChildCount + additionalChildCount;
+
+    ASSERT(liveChildCount > 1 || additionalElements.size() > 0);
+
+    DestroySortedCollection();
+    m_fSortedElementsDirty = false;
+
+    // Build the keys in natural order first. The order component of the key is the position the element
+    // would have without any ZIndex, which makes the sort below stable with respect to that position.
+    m_sortedKeys.reserve(totalChildCount);
+    for (UINT i = 0; i < totalChildCount; i++)
     {
-        if (uiChildCount == 1)
+        CUIElement *next;
+        if (additionalElementsAboveChildren)
         {
-            //
-            // There's only one child so order doesn't matter. Return the unsorted collection.
-            // The collection may be dirty for sorting when it contains only one element.
-            // Keep it dirty so that when a second element is added we check whether sorting
-            // is necessary.
-            //
-            *pppUIElements = doarray_to_elementarray_cast(GetCollection().data());
-            *puiChildCount = 1;
+            // Position additionalElements above the live children
+            next = (i < liveChildCount) ? (*this)[i] : additionalElements[i - liveChildCount];
         }
-        else if (uiChildCount > 1)
+        else
         {
-            CUIElement **ppUnsortedUIElements = doarray_to_elementarray_cast(GetCollection().data());
+            // Position additionalElements below the live children
+            next = (i < additionalChildCount) ? additionalElements[i] : (*this)[i - additionalChildCount];
+        }
 
-            if (!m_fSortedElementsDirty)
-            {
-                //
-                // If we're not dirty for sorting then return the existing sorted list, or,
-                // if we don't have one, the elements in natural order.
-                //
-                *pppUIElements = m_ppSortedUIElements ? m_ppSortedUIElements : ppUnsortedUIElements;
-            }
-            else
-            {
-                //
-                // We're dirty for sorting but we don't know whether we need a sorted
-                // collection. By default we don't need a sorted collection and we render in
-                // the order of the child elements. But if one of the child elements has a
-                // nonzero ZIndex or a projection, then we need to sort the children and
-                // render in sorted order.
-                //
-                if (NeedsToSort(GetCollection()))
-                {
-                    SortChildren(additionalElements, true);
-                    *pppUIElements = m_ppSortedUIElements;
-                }
-                else
-                {
-                    DestroySortedCollection();
-                    SetSortedCollectionDirty(false);
-                    *pppUIElements = ppUnsortedUIElements;
-                }
-            }
-            *puiChildCount = uiChildCount;
+        const INT32 zIndex = next->GetZIndex();
+        if (zIndex != 0)
+        {
+            m_nonZeroZIndexChildCount++;
+        }
+        m_sortedKeys.push_back({ zIndex, i });
+    }
+
+    if (additionalChildCount == 0 && m_nonZeroZIndexChildCount == 0)
+    {
+        // Nothing to sort, render in the order of the child collection.
+        m_sortedKeys.clear();
+        return liveChildCount;
+    }
+
+    std::sort(m_sortedKeys.begin(), m_sortedKeys.end());
+
+    m_sortedUIElements.resize(totalChildCount);
+    for (UINT i = 0; i < totalChildCount; i++)
+    {
+        const UINT order = m_sortedKeys[i].order;
+        if (additionalElementsAboveChildren)
+        {
+            m_sortedUIElements[i] = (order < liveChildCount) ? (*this)[order] : additionalElements[order - liveChildCount];
+        }
+        else
+        {
+            m_sortedUIElements[i] = (order < additionalChildCount) ? additionalElements[order] : (*this)[order - additionalChildCount];
         }
     }
+
+    m_sortedChildrenIncludeUnloading = (additionalChildCount > 0);
+
+    return totalChildCount;
 }
 
 //------------------------------------------------------------------------
 //
 //  Synopsis:
-//      Determines whether a list of CUIElements needs to be sorted
-//      before being rendered.
+//      Returns the position of a child in the sorted collection, or -1.
+//  This is a linear search, used when the child's draw order key isn't
+//  known (e.g. its old ZIndex after a ZIndex change).
 //
 //------------------------------------------------------------------------
-bool
-CUIElementCollection::NeedsToSort(
-    _In_ const std::vector<CDependencyObject*>& unsortedUIElements) const
+int CUIElementCollection::FindSortedChild(_In_ const CUIElement* pChild) const
 {
-    for (XUINT32 i = 0; i < unsortedUIElements.size(); i++)
+    auto it = std::find(m_sortedUIElements.begin(), m_sortedUIElements.end(), pChild);
+    return (it != m_sortedUIElements.end()) ? static_cast<int>(it - m_sortedUIElements.begin()) : -1;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Returns the position of a child with the given draw order key in
+//      the sorted collection by binary search, or -1.
+//
+//------------------------------------------------------------------------
+int CUIElementCollection::FindSortedChild(_In_ const RenderOrderKey& key, _In_ const CUIElement* pChild) const
+{
+    auto it = std::lower_bound(m_sortedKeys.begin(), m_sortedKeys.end(), key);
+    if (it != m_sortedKeys.end() && it->zIndex == key.zIndex && it->order == key.order)
     {
-        CUIElement *pChild = reinterpret_cast<CUIElement*>(unsortedUIElements[i]);
-        if (pChild->GetZIndex() != 0)
+        const size_t position = it - m_sortedKeys.begin();
+        if (m_sortedUIElements[position] == pChild)
         {
-            return true;
+            return static_cast<int>(position);
         }
     }
 
-    return false;
+    return -1;
 }
 
 //------------------------------------------------------------------------
 //
 //  Synopsis:
-//      Builds the sorted collection, sorting by draw order.
+//      Inserts a child into the sorted collection at the position given by
+//      a binary search on its draw order key.
 //
 //------------------------------------------------------------------------
-UINT CUIElementCollection::SortChildren(
-    const std::vector<CUIElement*>& additionalElements, // Elements to include in addition to the live elements in the collection
-    bool additionalElementsAboveChildren)               // true => position additionalElement above live children, else below
+void CUIElementCollection::InsertSortedChild(_In_ const RenderOrderKey& key, _In_ CUIElement* pChild)
 {
-    CUIElement **sortedElements = NULL;
+    const size_t position = std::lower_bound(m_sortedKeys.begin(), m_sortedKeys.end(), key) - m_sortedKeys.begin();
 
-    UINT liveChildCount = GetCount();
-    UINT additionalChildCount = static_cast<UINT>(additionalElements.size());
-    UINT totalChildCount = liveChildCount + additionalChildCount;
+    m_sortedKeys.insert(m_sortedKeys.begin() + position, key);
+    m_sortedUIElements.insert(m_sortedUIElements.begin() + position, pChild);
 
-    ASSERT(liveChildCount > 1 || additionalElements.size() > 0);
+    if (key.zIndex != 0)
+    {
+        m_nonZeroZIndexChildCount++;
+    }
+}
 
-    DestroySortedCollection();
+void CUIElementCollection::EraseSortedChild(_In_ size_t position)
+{
+    if (m_sortedKeys[position].zIndex != 0)
+    {
+        ASSERT(m_nonZeroZIndexChildCount > 0);
+        m_nonZeroZIndexChildCount--;
+    }
 
-    sortedElements = new CUIElement *[totalChildCount];
+    m_sortedKeys.erase(m_sortedKeys.begin() + position);
+    m_sortedUIElements.erase(m_sortedUIElements.begin() + position);
+}
 
-    // Use stable insertion sort.
-    for (UINT i = 0, j; i < totalChildCount; i++)
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Updates the render order after a child was inserted at nIndex.
+//
+//------------------------------------------------------------------------
+void CUIElementCollection::OnChildInsertedForRenderOrder(_In_ XUINT32 nIndex, _In_ CUIElement* pChild)
+{
+    if (CanUpdateSortedChildrenInPlace()
+        && nIndex < GetCount()
+        && (*this)[nIndex] == pChild)
     {
-        //
-        // Everything from 0 to i-1 has been sorted. Get the element at i and swap it
-        // left into its sorted position.
-        //
-        CUIElement *next;
-        if (additionalElementsAboveChildren)
+        for (RenderOrderKey& key : m_sortedKeys)
         {
-            // Position additionalElements above the live children
-            if (i < liveChildCount)
-            {
-                next = static_cast<CUIElement*>((*this)[i]);
-            }
-            else
+            if (key.order >= nIndex)
             {
-                next = additionalElements[i - liveChildCount];
+                key.order++;
             }
         }
-        else
+
+        InsertSortedChild({ pChild->GetZIndex(), nIndex }, pChild);
+        return;
+    }
+
+    //
+    // Two cases when we need to mark the collection as dirty for checking and re-sorting:
+    //   1. The child with a ZIndex is added
+    //   2. The child collection is already sorted (but couldn't be updated in place above)
+    //
+    // Note: The sort dirtiness is ignored if there are no children or there is one child.
+    // It won't cause checking/sorting and won't be cleared until we have added a second
+    // child.
+    //
+    if (pChild->GetZIndex() != 0 || HasSortedChildren())
+    {
+        SetSortedCollectionDirty(TRUE);
+    }
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Updates the render order after the child at nIndex was removed.
+//
+//------------------------------------------------------------------------
+void CUIElementCollection::OnChildRemovedForRenderOrder(_In_ XUINT32 nIndex, _In_opt_ CDependencyObject* pChild)
+{
+    if (CanUpdateSortedChildrenInPlace() && pChild)
+    {
+        CUIElement* pUIElement = static_cast<CUIElement*>(pChild);
+        const int position = FindSortedChild({ pUIElement->GetZIndex(), nIndex }, pUIElement);
+        if (position >= 0)
         {
-            // Position additionalElements below the live children
-            if (i < additionalChildCount)
+            EraseSortedChild(position);
+
+            for (RenderOrderKey& key : m_sortedKeys)
             {
-                next = additionalElements[i];
+                if (key.order > nIndex)
+                {
+                    key.order--;
+                }
             }
-            else
+
+            if (m_nonZeroZIndexChildCount == 0)
             {
-                next = static_cast<CUIElement*>((*this)[i - additionalChildCount]);
+                // The remaining children are back in natural order.
+                DestroySortedCollection();
             }
+            return;
         }
-        for (j = i; j > 0 && next->IsDrawOrderSmallerThan(sortedElements[j - 1]); j--)
+    }
+
+    // A removed element needs to be removed from the existing sorted collection.
+    if (HasSortedChildren())
+    {
+        SetSortedCollectionDirty(TRUE);
+    }
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Moves a child to its new position in the render order after its
+//      ZIndex changed. Only the changed child is repositioned, the rest of
+//      the sorted collection is unaffected.
+//
+//------------------------------------------------------------------------
+void CUIElementCollection::OnChildZIndexChanged(_In_ CUIElement* pChild)
+{
+    if (CanUpdateSortedChildrenInPlace())
+    {
+        const int position = FindSortedChild(pChild);
+
+        // The child can already be gone from the collection (e.g. while it's being unloaded), in which case
+        // its key is stale and the collection needs a full sort.
+        if (position >= 0
+            && m_sortedKeys[position].order < GetCount()
+            && (*this)[m_sortedKeys[position].order] == pChild)
         {
-            sortedElements[j] = sortedElements[j - 1];
+            const RenderOrderKey key = { pChild->GetZIndex(), m_sortedKeys[position].order };
+
+            if (key.zIndex != m_sortedKeys[position].zIndex)
+            {
+                EraseSortedChild(position);
+
+                if (m_nonZeroZIndexChildCount == 0 && key.zIndex == 0)
+                {
+                    // The last nonzero ZIndex was reset, the children are back in natural order.
+                    DestroySortedCollection();
+                }
+                else
+                {
+                    InsertSortedChild(key, pChild);
+                }
+            }
+            return;
         }
-        sortedElements[j] = next;
     }
 
-    m_ppSortedUIElements = sortedElements;
-    m_fSortedElementsDirty = false;
-
-    return totalChildCount;
+    SetSortedCollectionDirty(TRUE);
 }
 
 //------------------------------------------------------------------------
@@ -448,6 +608,7 @@ CUIElementCollection::Append(_In_ CDependencyObject *pObject, _Out_opt_ XUINT32
     }
 
     OnChildrenChanged(pObject);
+    OnChildInsertedForRenderOrder(GetCount() - 1, pUIElement);
     pOwner->InvalidateMeasure();
 
     return S_OK;
@@ -482,6 +643,7 @@ _Check_return_ HRESULT CUIElementCollection::Insert(_In_ XUINT32 nIndex, _In_ CD
     }
 
     OnChildrenChanged(pObject);
+    OnChildInsertedForRenderOrder(nIndex, pUIElement);
     pOwner->InvalidateMeasure();
 
     {
@@ -533,6 +695,12 @@ CUIElementCollection::MoveInternal(_In_ XINT32 nIndex, _In_ XINT32 nPosition)
 
     IFC(CDOCollection::MoveInternal(nIndex, nPosition));
 
+    // Moving shifts the positions of the children in between, which are part of the draw order keys.
+    if (HasSortedChildren())
+    {
+        SetSortedCollectionDirty(TRUE);
+    }
+
     {
         auto callback = m_wrChangeCallback.lock();
 
@@ -703,6 +871,9 @@ CUIElementCollection::RemoveUnloadedElement(_In_ CUIElement* pTarget, UINT unloa
         // If there are no remaining reasons for keeping this in unloading storage, then finish unloading,
         // otherwise there are remaining reasons to keep this element in unloading storage.
         *removeLogic = static_cast<UnloadCleanup>(*removeLogic & ~unloadContext);
+
+        // The remaining reasons determine whether the element is still rendered with the children.
+        SetSortedCollectionDirty(TRUE);
         if (((*removeLogic & UC_REFERENCE_ThemeTransition) == 0) &&
             ((*removeLogic & UC_REFERENCE_ConnectedAnimation) == 0) &&
             ((*removeLogic & UC_REFERENCE_ImplicitAnimation) == 0))
@@ -1099,6 +1270,7 @@ _Check_return_ bool CUIElementCollection::UnloadElement(_In_ XUINT32 nIndex, _In
 
                 m_pUnloadingStorage->Add(pRemove, removeLogicToExecute);
                 removeLogicToExecute = NULL;
+                SetSortedCollectionDirty(TRUE);
                 bUnloaded = TRUE;
             }
             else
@@ -1207,6 +1379,11 @@ CUIElementCollection::Remove(_In_ XUINT32 nIndex, _In_ CDependencyObject *pObjec
         pObject = static_cast<CDependencyObject*>(CDOCollection::RemoveAt(nIndex));
     }
 
+    if (pObject)
+    {
+        OnChildRemovedForRenderOrder(nIndex, pObject);
+    }
+
     if (pObject && pOwner)
     {
         pOwner->InvalidateMeasure();
@@ -1312,6 +1489,7 @@ CUIElementCollection::RemoveAllElements(_In_ bool bTryUnloadingElements)
             // Since we removed the elements above in reverse z order, this will produce a reverse order in unloading storage.
             // Reverse this result so that the rendered z order more closely reflects the original z order in GetChildrenInRenderOrderInternal().
             std::reverse(m_pUnloadingStorage->m_unloadingElements.begin(), m_pUnloadingStorage->m_unloadingElements.end());
+            SetSortedCollectionDirty(TRUE);
         }
     }
 
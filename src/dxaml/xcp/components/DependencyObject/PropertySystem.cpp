@@ -37,6 +37,8 @@
 #include "KeyTimeVO.h"
 #include <FocusableHelper.h>
 #include "CircularMemoryLogger.h"
+#include <array>
+#include <atomic>
 
 using namespace DirectUI;
 
@@ -121,6 +123,49 @@ static void AppendFailedUpdateValueInfo(
     }
 }
 
+// Typical sparse value table size of the recent instances of each built-in type, capped. Elements of a type tend to
+// have the same properties set on them (e.g. by the same template), so a new instance allocates its table at that
+// size once instead of growing it a property at a time.
+//
+// The hint is an exponential moving average, in 1/16ths of an entry, of the table sizes of instances the parser has
+// finished creating (including template parts), so an occasional instance with many values raises it only a little
+// and later instances bring it back down. It is sampled once per instance rather than as values are set, since
+// setting values on several instances at once would otherwise be counted as one large table. Updated with relaxed
+// atomics since it's only a hint and may be shared by several UI threads.
+static constexpr std::size_t s_maxSparseValueTableSizeHint = 16;
+static constexpr std::uint16_t s_sparseValueTableSizeHintScale = 16;
+static constexpr std::uint16_t s_sparseValueTableSizeHintWeightShift = 3;
+static std::array<std::atomic<std::uint16_t>, KnownTypeCount> s_sparseValueTableSizeHints;
+
+static std::size_t GetSparseValueTableSizeHint(KnownTypeIndex typeIndex)
+{
+    const auto index = static_cast<std::size_t>(typeIndex);
+
+    if (index < KnownTypeCount)
+    {
+        const std::uint16_t average = s_sparseValueTableSizeHints[index].load(std::memory_order_relaxed);
+        return (average + s_sparseValueTableSizeHintScale / 2) / s_sparseValueTableSizeHintScale;
+    }
+
+    return 0;
+}
+
+void CDependencyObject::RecordSparseValueTableSize() const
+{
+    const auto index = static_cast<std::size_t>(GetTypeIndex());
+
+    if (index < KnownTypeCount)
+    {
+        const std::size_t size = std::min<std::size_t>(m_pValueTable ? m_pValueTable->size() : 0, s_maxSparseValueTableSizeHint);
+        const std::uint16_t average = s_sparseValueTableSizeHints[index].load(std::memory_order_relaxed);
+
+        s_sparseValueTableSizeHints[index].store(
+            static_cast<std::uint16_t>(average - (average >> s_sparseValueTableSizeHintWeightShift)
+                + ((size * s_sparseValueTableSizeHintScale) >> s_sparseValueTableSizeHintWeightShift)),
+            std::memory_order_relaxed);
+    }
+}
+
 // Returns TRUE if the dependency property stores a back-reference to something else in the visual tree. When
 // walking through objects in the visual tree, we don't want to walk through back references.
 bool CDependencyObject::IsDependencyPropertyBackReference(_In_ KnownPropertyIndex propertyIndex)
@@ -2527,6 +2572,7 @@ _Check_return_ HRESULT CDependencyObject::SetEffectiveValueInSparseStorage(_In_
         AutoReentrantReferenceLock lock(DXamlServices::GetPeerTableHost());
 
         m_pValueTable.reset(new SparseValueTable);
+        m_pValueTable->reserve(GetSparseValueTableSizeHint(GetTypeIndex()));
     }
 
     SparseValueTable::iterator sparseEntry;
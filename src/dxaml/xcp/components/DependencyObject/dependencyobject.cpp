@@ -49,6 +49,7 @@ CDependencyObject::CDependencyObject(_In_ CCoreServices* pCore)
     , m_objectStrictness(ObjectStrictness::Agnostic)
     , m_checkForResourceOverrides(false)
     , m_canParserOverwriteBaseUri(true)
+    , m_hasEventRequests(false)
 {}
 
 KnownTypeIndex CDependencyObject::GetTypeIndex() const
@@ -12,6 +12,7 @@
 #include "ImagingUtility.h"
 #include <MUX-ETWEvents.h>
 #include <Clock.h>
+#include <thread>
 
 /*
     AsyncImageDecoder creates background thread to make calls to IImageDecoder.
@@ -37,6 +38,7 @@
 */
 
 std::atomic<bool> AsyncImageDecoder::s_suspendOffThreadDecoding = false;
+AsyncImageDecoder::DecodeQueue AsyncImageDecoder::s_decodeQueue;
 
 AsyncImageDecoder::AsyncImageDecoder(
     std::unique_ptr<IImageDecoder> spImageDecodingContext,
@@ -65,6 +67,10 @@ AsyncImageDecoder::~AsyncImageDecoder()
     // be completed after destruction of the AsyncImageDecoder
 
     m_spSharedState->CancelPresent();
+
+    // A decode that hasn't started yet is no longer needed, e.g. the image left the viewport
+    // and its source was released. Let the decode queue drop it instead of decoding it.
+    m_spSharedState->m_abandoned = true;
 }
 
 bool AsyncImageDecoder::SharedState::NeedMoreFrames() const
@@ -108,21 +114,100 @@ HRESULT AsyncImageDecoder::SetupDecodeCurrentFrame(std::shared_ptr<SharedState>
     ASSERT(!sharedState->m_decodeInProgress);
     sharedState->m_decodeInProgress = true;
 
+    IFC_RETURN(QueueDecode(std::move(sharedState)));
+
+    return S_OK;
+}
+
+// static
+uint32_t AsyncImageDecoder::GetMaxDecodeWorkers()
+{
+    // Decoding is CPU bound, so leave a core for the UI thread but always allow some parallelism.
+    static const uint32_t s_maxDecodeWorkers = std::min(std::max(std::thread::hardware_concurrency(), 3u) - 1, 8u);
+    return s_maxDecodeWorkers;
+}
+
+// static
+HRESULT AsyncImageDecoder::QueueDecode(std::shared_ptr<SharedState> sharedState)
+{
+    {
+        std::lock_guard<std::mutex> lock(s_decodeQueue.m_mutex);
+
+        if (s_decodeQueue.m_activeWorkers >= GetMaxDecodeWorkers())
+        {
+            // Every worker is busy. The decode runs when a worker frees up, ahead of any animation frames
+            // if something is waiting to present it.
+            auto& pending = sharedState->m_needsPresentAfterDecode ? s_decodeQueue.m_pendingPresents : s_decodeQueue.m_pendingFrames;
+            pending.push_back(std::move(sharedState));
+            return S_OK;
+        }
+
+        s_decodeQueue.m_activeWorkers++;
+    }
+
+    auto releaseWorkerOnFailure = wil::scope_exit([&]
+    {
+        std::lock_guard<std::mutex> lock(s_decodeQueue.m_mutex);
+        s_decodeQueue.m_activeWorkers--;
+    });
+
     // Capture strong reference to shared state so it is not destroyed during callback run
     auto asyncJob = wrl::Callback<FreeThreaded<wsyt::IWorkItemHandler>>(
         [sharedState = std::move(sharedState)](_In_opt_ wf::IAsyncAction*)
     {
-        std::lock_guard<std::mutex> lock(sharedState->m_mutex);
-        return OnDecodeCurrentFrame(sharedState);
+        RunDecodes(sharedState);
+        return S_OK;
     });
 
     // TODO: Potentially use the spAsyncAction for cancellation
     wrl::ComPtr<wf::IAsyncAction> spAsyncAction;
     IFC_RETURN(ThreadPoolService::GetInstance().GetThreadPoolFactory()->RunAsync(asyncJob.Get(), &spAsyncAction));
 
+    releaseWorkerOnFailure.release();
+
     return S_OK;
 }
 
+// static
+void AsyncImageDecoder::RunDecodes(std::shared_ptr<SharedState> sharedState)
+{
+    // Runs on a thread pool worker. Keep decoding queued frames until the queue is empty.
+    while (sharedState != nullptr)
+    {
+        {
+            std::lock_guard<std::mutex> lock(sharedState->m_mutex);
+
+            if (sharedState->m_abandoned)
+            {
+                sharedState->m_decodeInProgress = false;
+            }
+            else
+            {
+                IGNOREHR(OnDecodeCurrentFrame(sharedState));
+            }
+        }
+
+        sharedState.reset();
+
+        std::lock_guard<std::mutex> lock(s_decodeQueue.m_mutex);
+
+        if (!s_decodeQueue.m_pendingPresents.empty())
+        {
+            sharedState = std::move(s_decodeQueue.m_pendingPresents.front());
+            s_decodeQueue.m_pendingPresents.pop_front();
+        }
+        else if (!s_decodeQueue.m_pendingFrames.empty())
+        {
+            sharedState = std::move(s_decodeQueue.m_pendingFrames.front());
+            s_decodeQueue.m_pendingFrames.pop_front();
+        }
+        else
+        {
+            s_decodeQueue.m_activeWorkers--;
+        }
+    }
+}
+
 // static
 HRESULT AsyncImageDecoder::OnDecodeCurrentFrame(std::shared_ptr<SharedState> sharedState)
 {
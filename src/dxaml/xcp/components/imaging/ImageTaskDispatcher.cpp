@@ -41,14 +41,13 @@ ImageTaskDispatcher::QueueTask(_In_ IImageTask* task)
                 // a task off the front of the queue before executing it, so it won't be found in the queue again.
                 // We can only replace a task that's still in the queue but hasn't executed yet.
                 //
-                for (auto &existingTask: m_tasks)
+                auto insertResult = m_requestPositions.emplace(requestId, m_dequeuedTaskCount + m_tasks.size());
+                if (!insertResult.second)
                 {
-                    if (existingTask->GetRequestId() == requestId)
-                    {
-                        existingTask.reset(task);
-                        existingTaskReplaced = true;
-                        break;
-                    }
+                    auto& existingTask = m_tasks[static_cast<size_t>(insertResult.first->second - m_dequeuedTaskCount)];
+                    ASSERT(existingTask->GetRequestId() == requestId);
+                    existingTask.reset(task);
+                    existingTaskReplaced = true;
                 }
             }
 
@@ -147,6 +146,14 @@ _Check_return_ HRESULT ImageTaskDispatcher::Execute()
                 {
                     task = std::move(m_tasks.front());
                     m_tasks.pop_front();
+
+                    // The task is no longer in the queue, so a new task with its request id must be queued again.
+                    auto requestId = task->GetRequestId();
+                    if (requestId != 0)
+                    {
+                        m_requestPositions.erase(requestId);
+                    }
+                    m_dequeuedTaskCount++;
                 }
             }
 
@@ -207,4 +214,6 @@ void ImageTaskDispatcher::Shutdown()
     ::InterlockedExchange(&m_hasCallbackQueued, FALSE);
 
     m_tasks.clear();
+    m_requestPositions.clear();
+    m_dequeuedTaskCount = 0;
 }
@@ -9,6 +9,7 @@
 #include <xref_ptr.h>
 #include <weakref_ptr.h>
 #include <windows.system.threading.h>
+#include <deque>
 #include <memory>
 #include <mutex>
 
@@ -56,6 +57,7 @@ private:
 
         bool m_suspended = false;
         bool m_stopped = false;
+        bool m_abandoned = false;
         bool m_hasDecodingResult = false;
         bool m_needsPresentAfterDecode = true;
 
@@ -84,6 +86,24 @@ private:
 
     std::shared_ptr<SharedState> m_spSharedState;
 
+    // Frame decodes waiting for one of a bounded number of thread pool workers. Decodes the UI thread waits on to
+    // present, i.e. the first frame of a newly set or resized image, wait in their own lane and are taken before
+    // the next frames of running animations. Each lane is served in request order. Workers skip decodes whose
+    // AsyncImageDecoder was destroyed while they waited.
+    struct DecodeQueue
+    {
+        std::mutex m_mutex;
+        std::deque<std::shared_ptr<SharedState>> m_pendingPresents;
+        std::deque<std::shared_ptr<SharedState>> m_pendingFrames;
+        uint32_t m_activeWorkers = 0;
+    };
+
+    static DecodeQueue s_decodeQueue;
+
+    static uint32_t GetMaxDecodeWorkers();
+    static _Check_return_ HRESULT QueueDecode(std::shared_ptr<SharedState> sharedState);
+    static void RunDecodes(std::shared_ptr<SharedState> sharedState);
+
     static _Check_return_ HRESULT SetupDecodeCurrentFrame(std::shared_ptr<SharedState> sharedState);
     static _Check_return_ HRESULT OnDecodeCurrentFrame(std::shared_ptr<SharedState> sharedState);
     static _Check_return_ HRESULT ScheduleNextPresent(std::shared_ptr<SharedState> sharedState);
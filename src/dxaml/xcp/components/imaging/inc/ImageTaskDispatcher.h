@@ -5,6 +5,7 @@
 #include <wil/resource.h>
 #include <palnetwork.h>
 #include <deque>
+#include <unordered_map>
 
 class CCoreServices;
 
@@ -30,6 +31,13 @@ private:
 
     CCoreServices* m_core;
     std::deque<xref_ptr<IImageTask>> m_tasks;
+
+    // Position of the queued task for each non-zero request id, so a newer task under the same request id
+    // replaces it without scanning the queue. Positions count every task ever queued; the task at position p
+    // is m_tasks[p - m_dequeuedTaskCount].
+    std::unordered_map<uint64_t, uint64_t> m_requestPositions;
+    uint64_t m_dequeuedTaskCount = 0;
+
     wil::critical_section m_taskLock;
     LONG m_hasCallbackQueued = FALSE;
     bool m_shuttingdown = false;
@@ -164,6 +164,129 @@ void MetadataAPI::ExtractShortName(_In_ const xstring_ptr_view& strTypeFullName,
     }
 }
 
+namespace
+{
+    // Open addressing hash table of indices into the generated metadata tables, so resolving a built-in name takes a
+    // probe or two instead of a scan. Entries with equal hashes are found in the order they were added. Callers verify
+    // every candidate against the generated tables.
+    class BuiltinNameTable
+    {
+    public:
+        explicit BuiltinNameTable(std::size_t maxCount)
+        {
+            std::size_t capacity = 16;
+
+            while (capacity < maxCount * 2)
+            {
+                capacity *= 2;
+            }
+
+            m_slots.resize(capacity);
+        }
+
+        void Add(std::size_t hash, UINT16 index)
+        {
+            ASSERT(index != 0);
+
+            const std::size_t mask = m_slots.size() - 1;
+            std::size_t slot = hash & mask;
+
+            while (m_slots[slot].m_index != 0)
+            {
+                slot = (slot + 1) & mask;
+            }
+
+            m_slots[slot].m_hash = static_cast<UINT32>(hash);
+            m_slots[slot].m_index = index;
+        }
+
+        // Returns the first index added with this hash for which isMatch returns true, or 0.
+        template <typename IsMatch>
+        UINT16 Find(std::size_t hash, IsMatch&& isMatch) const
+        {
+            const std::size_t mask = m_slots.size() - 1;
+
+            for (std::size_t slot = hash & mask; m_slots[slot].m_index != 0; slot = (slot + 1) & mask)
+            {
+                if (m_slots[slot].m_hash == static_cast<UINT32>(hash) && isMatch(m_slots[slot].m_index))
+                {
+                    return m_slots[slot].m_index;
+                }
+            }
+
+            return 0;
+        }
+
+    private:
+        struct Slot
+        {
+            UINT32 m_hash = 0;
+            UINT16 m_index = 0;
+        };
+
+        std::vector<Slot> m_slots;
+    };
+
+    std::size_t GetPropertyNameHash(KnownTypeIndex eDeclaringTypeIndex, std::size_t nameHash)
+    {
+        return nameHash ^ (static_cast<std::size_t>(eDeclaringTypeIndex) * 0x9E3779B9u);
+    }
+
+    // Indexes of the built-in type short names, namespace names and (declaring type, property name) pairs. Built on
+    // first use and never modified afterwards, so lookups don't need a lock.
+    class BuiltinNameIndex
+    {
+    public:
+        BuiltinNameIndex()
+            : m_types(ARRAY_SIZE(c_aTypeNames))
+            , m_namespaces(KnownNamespaceCount)
+            , m_properties(KnownPropertyCount)
+        {
+            // Start at 1 to skip KnownTypeIndex::UnknownType, like MapTypeNameLengthToSearchRange.
+            for (std::size_t i = 1; i < ARRAY_SIZE(c_aTypeNames); i++)
+            {
+                const UINT nTypeIndex = static_cast<UINT>(c_aTypeNames[i].m_nTypeIndex);
+                m_types.Add(xstring_ptr(c_aTypeNameInfos[nTypeIndex].m_strNameStorage).GetHash(), static_cast<UINT16>(nTypeIndex));
+            }
+
+            // Start at 1 to skip KnownNamespaceIndex::UnknownNamespace.
+            for (UINT16 i = 1; i < KnownNamespaceCount; i++)
+            {
+                m_namespaces.Add(xstring_ptr(c_aNamespaces[i].m_strNameStorage).GetHash(), i);
+            }
+
+            // A type's property list is its own properties followed by its base type's list, so add each
+            // type's own properties under that type.
+            for (UINT16 i = 1; i < KnownTypeCount; i++)
+            {
+                const KnownTypeIndex eTypeIndex = static_cast<KnownTypeIndex>(i);
+
+                for (const CPropertyBase* pb = MetadataAPI::GetPropertyBaseByIndex(c_aTypeProperties[i].m_nFirstPropertyIndex);
+                     pb->GetIndex() != KnownPropertyIndex::UnknownType_UnknownProperty && pb->GetDeclaringTypeIndex() == eTypeIndex;
+                     pb = pb->GetNextProperty())
+                {
+                    m_properties.Add(GetPropertyNameHash(eTypeIndex, pb->GetName().GetHash()), static_cast<UINT16>(pb->GetIndex()));
+                }
+            }
+        }
+
+        const BuiltinNameTable& GetTypes() const { return m_types; }
+        const BuiltinNameTable& GetNamespaces() const { return m_namespaces; }
+        const BuiltinNameTable& GetProperties() const { return m_properties; }
+
+    private:
+        BuiltinNameTable m_types;
+        BuiltinNameTable m_namespaces;
+        BuiltinNameTable m_properties;
+    };
+
+    const BuiltinNameIndex& GetBuiltinNameIndex()
+    {
+        static const BuiltinNameIndex s_index;
+        return s_index;
+    }
+}
+
 // Resolves a built-in type by its short name.
 const CClassInfo* MetadataAPI::GetBuiltinClassInfoByName(_In_ const xstring_ptr_view& strTypeName)
 {
@@ -181,17 +304,17 @@ const CClassInfo* MetadataAPI::GetBuiltinClassInfoByName(_In_ const xstring_ptr_
         strTypeName.Demote(&strNormalizedTypeName);
     }
 
-    UINT nEndIndex;
-    UINT nStartIndex = MapTypeNameLengthToSearchRange(nTypeNameLength, &nEndIndex);
+    const UINT16 nTypeIndex = GetBuiltinNameIndex().GetTypes().Find(
+        strNormalizedTypeName.GetHash(),
+        [&](UINT16 nCandidateIndex)
+        {
+            const xstring_ptr_storage& strName = c_aTypeNameInfos[nCandidateIndex].m_strNameStorage;
+            return strName.Count == nTypeNameLength && strNormalizedTypeName.Equals(strName.Buffer, strName.Count);
+        });
 
-    for (UINT i = nStartIndex; i < nEndIndex; i++)
+    if (nTypeIndex != 0)
     {
-        UINT nTypeIndex = static_cast<UINT>(c_aTypeNames[i].m_nTypeIndex);
-        xstring_ptr_storage strName = c_aTypeNameInfos[nTypeIndex].m_strNameStorage;
-        if (strNormalizedTypeName.Equals(strName.Buffer, strName.Count))
-        {
-            return reinterpret_cast<const CClassInfo*>(&c_aTypes[nTypeIndex]);
-        }
+        return reinterpret_cast<const CClassInfo*>(&c_aTypes[nTypeIndex]);
     }
 
     return nullptr;
@@ -200,26 +323,18 @@ const CClassInfo* MetadataAPI::GetBuiltinClassInfoByName(_In_ const xstring_ptr_
 // Gets a built-in namespace by its name.
 const CNamespaceInfo* MetadataAPI::GetBuiltinNamespaceByName(_In_ const xstring_ptr_view& strNamespaceName)
 {
-    UINT nExpectedLength = strNamespaceName.GetCount();
+    const UINT nExpectedLength = strNamespaceName.GetCount();
+    const UINT16 nNamespaceIndex = GetBuiltinNameIndex().GetNamespaces().Find(
+        strNamespaceName.GetHash(),
+        [&](UINT16 nCandidateIndex)
+        {
+            const xstring_ptr_storage& strName = c_aNamespaces[nCandidateIndex].m_strNameStorage;
+            return strName.Count == nExpectedLength && strNamespaceName.Equals(strName.Buffer, strName.Count);
+        });
 
-    // if the value of avoiding the loop ever exceeds the cost of creating
-    // a valuestore, then we'll do that.
-    // Start at 1 to skip KnownNamespaceIndex::UnknownNamespace.
-    for (XUINT32 i = 1; i < ARRAY_SIZE(c_aNamespaces); i++)
+    if (nNamespaceIndex != 0)
     {
-        UINT nCurrentLength = c_aNamespaces[i].m_strNameStorage.Count;
-        if (nCurrentLength == nExpectedLength)
-        {
-            if (strNamespaceName.Equals(c_aNamespaces[i].m_strNameStorage.Buffer, nCurrentLength))
-            {
-                return reinterpret_cast<const CNamespaceInfo*>(&c_aNamespaces[i]);
-            }
-        }
-        else if (nCurrentLength > nExpectedLength)
-        {
-            // c_aNamespaces is sorted by namespace name length, so if we haven't found anything by now, it doesn't exist in this array.
-            return nullptr;
-        }
+        return reinterpret_cast<const CNamespaceInfo*>(&c_aNamespaces[nNamespaceIndex]);
     }
 
     return nullptr;
@@ -1279,20 +1394,31 @@ const CPropertyBase* MetadataAPI::TryGetBuiltInPropertyBaseByName(
 {
     if (IsKnownIndex(pType->GetIndex()))
     {
-        // Loop through the type's built-in DPs.
+        // Look for the name among the built-in DPs declared on the type, then on each of its base types, in the
+        // order the type's property list visits them.
+        const BuiltinNameTable& properties = GetBuiltinNameIndex().GetProperties();
+        const std::size_t nameHash = strName.GetHash();
 
-        for (const CPropertyBase* pb = pType->GetFirstProperty();
-             pb->GetIndex() != KnownPropertyIndex::UnknownType_UnknownProperty;
-             pb = pb->GetNextProperty())
+        for (const CClassInfo* pDeclaringType = pType;
+             pDeclaringType->GetIndex() != KnownTypeIndex::UnknownType;
+             pDeclaringType = pDeclaringType->GetBaseType())
         {
-            if (strName.Equals(pb->GetName()))
-            {
-                // Handle directive properties (such as x:Name).
-
-                if (allowDirectives || !pb->IsDirective())
+            const KnownTypeIndex eDeclaringTypeIndex = pDeclaringType->GetIndex();
+            const UINT16 nPropertyIndex = properties.Find(
+                GetPropertyNameHash(eDeclaringTypeIndex, nameHash),
+                [&](UINT16 nCandidateIndex)
                 {
-                    return pb;
-                }
+                    const CPropertyBase* pb = GetPropertyBaseByIndex(static_cast<KnownPropertyIndex>(nCandidateIndex));
+
+                    // Handle directive properties (such as x:Name).
+                    return pb->GetDeclaringTypeIndex() == eDeclaringTypeIndex
+                        && strName.Equals(pb->GetName())
+                        && (allowDirectives || !pb->IsDirective());
+                });
+
+            if (nPropertyIndex != 0)
+            {
+                return GetPropertyBaseByIndex(static_cast<KnownPropertyIndex>(nPropertyIndex));
             }
         }
     }
@@ -7,6 +7,7 @@
 #include <queue>
 #include <mutex>
 #include <chrono>
+#include <algorithm>
 #include <wil\resource.h>
 #include <Clock.h>
 #include <MUX-ETWEvents.h>
@@ -58,12 +59,23 @@ namespace
 
 ThreadedJobQueue::ThreadedJobQueue(
     ThreadingModel threadingModel,
-    bool terminateOnInactivity)
+    bool terminateOnInactivity,
+    uint32_t maxThreadCount)
     : m_threadingModel(threadingModel)
     // Initialize the m_keepAliveCount to 0 if the thread should terminate after a period of inactivity.
     // Otherwise initialize to 1 in the case that the thread lifetime should be tied to this objects lifetime.
     , m_keepAliveCount(terminateOnInactivity ? 0 : 1)
 {
+    ASSERT(maxThreadCount > 0);
+
+    // The workers are allocated up front so they can be referenced by their threads without holding
+    // the mutex.  Their threads are only created once jobs need them.
+    m_workers.resize(std::max(maxThreadCount, 1u));
+    for (auto& worker : m_workers)
+    {
+        worker = std::make_unique<Worker>();
+        worker->owner = this;
+    }
 }
 
 ThreadedJobQueue::~ThreadedJobQueue()
@@ -79,51 +91,168 @@ ThreadedJobQueue::~ThreadedJobQueue()
     {
         std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
 
-        // Clear the job queue
-        m_jobQueue.clear();
+        m_shutdown = true;
 
-        if (m_jobThread != nullptr)
+        for (auto& worker : m_workers)
         {
-            ASSERT(m_threadInterrupt != nullptr);
+            // Clear the job queue
+            worker->jobQueue.clear();
+
+            if (worker->jobThread != nullptr)
+            {
+                ASSERT(worker->threadInterrupt != nullptr);
 
-            m_shutdown = true;
-            ::SetEvent(m_threadInterrupt.get());
+                ::SetEvent(worker->threadInterrupt.get());
 
-            waitForThreadCompletion = true;
+                waitForThreadCompletion = true;
+            }
         }
     }
 
-    // Wait for the thread to complete if it is active
+    // Wait for the threads to complete if they are active
     if (waitForThreadCompletion)
     {
-        // Wait for the thread to complete.
+        // Wait for the threads to complete.
         // Things are shutting down anyway, so ignore failures.
         TraceThreadedJobQueueShutdownWaitBegin(reinterpret_cast<uint64_t>(this));
-        auto waitCode = ::WaitForSingleObject(m_jobThread.get(), INFINITE);
-        ASSERT(waitCode == WAIT_OBJECT_0);
-        TraceThreadedJobQueueShutdownWaitEnd(reinterpret_cast<uint64_t>(this), waitCode);
+        for (auto& worker : m_workers)
+        {
+            if (worker->jobThread != nullptr)
+            {
+                auto waitCode = ::WaitForSingleObject(worker->jobThread.get(), INFINITE);
+                ASSERT(waitCode == WAIT_OBJECT_0);
+                TraceThreadedJobQueueShutdownWaitEnd(reinterpret_cast<uint64_t>(this), waitCode);
+            }
+        }
     }
 
-    // Thread is complete, close the handles.
+    // Threads are complete, close the handles.
     // NOTE: These will call CloseHandle
-    m_threadInterrupt.reset();
-    m_jobThread.reset();
+    for (auto& worker : m_workers)
+    {
+        worker->threadInterrupt.reset();
+        worker->jobThread.reset();
+    }
 }
 
 void ThreadedJobQueue::QueueJob(
-    std::function<void(HWND)> job)
+    std::function<void(HWND)> job,
+    JobPriority priority)
 {
     std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
 
+    QueueJobOnWorker(ChooseWorker(), { std::move(job), true /* canMoveToOtherWorker */ }, priority);
+}
+
+void ThreadedJobQueue::QueueJobForWindow(
+    HWND hwnd,
+    std::function<void(HWND)> job,
+    JobPriority priority)
+{
+    std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
+
+    auto it = std::find_if(m_workers.begin(), m_workers.end(), [hwnd](const std::unique_ptr<Worker>& worker)
+    {
+        return worker->isThreadActive && worker->hwnd == hwnd;
+    });
+
+    // The thread that owns the window must be kept alive with a deferral.
+    FAIL_FAST_ASSERT(it != m_workers.end());
+
+    QueueJobOnWorker(**it, { std::move(job), false /* canMoveToOtherWorker */ }, priority);
+}
+
+void ThreadedJobQueue::QueueJobOnWorker(
+    Worker& worker,
+    Job job,
+    JobPriority priority)
+{
     TraceThreadedJobQueueSubmitJobInfo(
         reinterpret_cast<uint64_t>(this),
-        reinterpret_cast<uint64_t>(job.target<void()>()));
+        reinterpret_cast<uint64_t>(job.callback.target<void()>()));
 
     // Push the job and wake the thread up to process the request.
-    m_jobQueue.push_back(std::move(job));
+    if (priority == JobPriority::High)
+    {
+        worker.jobQueue.push_front(std::move(job));
+    }
+    else
+    {
+        worker.jobQueue.push_back(std::move(job));
+    }
+
+    EnsureThreadActive(worker);
+    ::SetEvent(worker.threadInterrupt.get());
+}
+
+// Picks the worker for a new job: an idle worker if there is one, otherwise a worker whose thread isn't running
+// yet, otherwise the worker with the fewest queued jobs.  Idle workers also take queued jobs from busy ones.
+ThreadedJobQueue::Worker& ThreadedJobQueue::ChooseWorker()
+{
+    Worker* inactiveWorker = nullptr;
+    Worker* leastBusyWorker = nullptr;
+
+    for (auto& worker : m_workers)
+    {
+        if (!worker->isThreadActive)
+        {
+            if (inactiveWorker == nullptr)
+            {
+                inactiveWorker = worker.get();
+            }
+        }
+        else if (!worker->isRunningJob && worker->jobQueue.empty())
+        {
+            return *worker;
+        }
+        else if (leastBusyWorker == nullptr || worker->jobQueue.size() < leastBusyWorker->jobQueue.size())
+        {
+            leastBusyWorker = worker.get();
+        }
+    }
 
-    EnsureThreadActive();
-    ::SetEvent(m_threadInterrupt.get());
+    return (inactiveWorker != nullptr) ? *inactiveWorker : *leastBusyWorker;
+}
+
+// Takes the next job from the worker's own queue, or else the most recently queued job that may move from the
+// worker with the most queued jobs.
+bool ThreadedJobQueue::TryTakeJob(
+    Worker& worker,
+    _Out_ std::function<void(HWND)>* job)
+{
+    if (!worker.jobQueue.empty())
+    {
+        *job = std::move(worker.jobQueue.front().callback);
+        worker.jobQueue.pop_front();
+        return true;
+    }
+
+    Worker* victim = nullptr;
+
+    for (auto& other : m_workers)
+    {
+        if (other.get() != &worker
+            && !other->jobQueue.empty()
+            && (victim == nullptr || other->jobQueue.size() > victim->jobQueue.size()))
+        {
+            victim = other.get();
+        }
+    }
+
+    if (victim != nullptr)
+    {
+        for (auto it = victim->jobQueue.rbegin(); it != victim->jobQueue.rend(); ++it)
+        {
+            if (it->canMoveToOtherWorker)
+            {
+                *job = std::move(it->callback);
+                victim->jobQueue.erase(std::next(it).base());
+                return true;
+            }
+        }
+    }
+
+    return false;
 }
 
 wistd::unique_ptr<ThreadedJobQueueDeferral> ThreadedJobQueue::GetDeferral()
@@ -145,54 +274,62 @@ void ThreadedJobQueue::DecrementDeferredKeepAliveCount()
     ASSERT(m_keepAliveCount > 0);
     m_keepAliveCount--;
 
-    // Interrupt at 0 ref count to see if the thread should terminate.
+    // Interrupt at 0 ref count to see if the threads should terminate.
     if (m_keepAliveCount == 0)
     {
-        ::SetEvent(m_threadInterrupt.get());
+        for (auto& worker : m_workers)
+        {
+            if (worker->isThreadActive)
+            {
+                ::SetEvent(worker->threadInterrupt.get());
+            }
+        }
     }
 
     TraceThreadedJobQueueUpdateExternalRefInfo(reinterpret_cast<uint64_t>(this), m_keepAliveCount);
 }
 
-void ThreadedJobQueue::EnsureThreadActive()
+void ThreadedJobQueue::EnsureThreadActive(
+    Worker& worker)
 {
     std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
-    if (!m_isThreadActive)
+    if (!worker.isThreadActive)
     {
-        m_lastJobTime = Jupiter::HighResolutionClock::now();
+        worker.lastJobTime = Jupiter::HighResolutionClock::now();
 
         wil::unique_handle threadInterrupt(::CreateEvent(
             nullptr,
             FALSE /* manualReset */,
             FALSE /* initialState */,
             nullptr));
-        m_threadInterrupt = std::move(threadInterrupt);
-        FAIL_FAST_ASSERT(m_threadInterrupt.get() != nullptr);
+        worker.threadInterrupt = std::move(threadInterrupt);
+        FAIL_FAST_ASSERT(worker.threadInterrupt.get() != nullptr);
 
         wil::unique_handle jobThread(::CreateThread(
             nullptr,
             0,
             StaticThreadCallback,
-            reinterpret_cast<void*>(this),
+            reinterpret_cast<void*>(&worker),
             0,
             nullptr));
-        m_jobThread = std::move(jobThread);
-        FAIL_FAST_ASSERT(m_jobThread.get() != nullptr);
+        worker.jobThread = std::move(jobThread);
+        FAIL_FAST_ASSERT(worker.jobThread.get() != nullptr);
 
-        m_isThreadActive = true;
+        worker.isThreadActive = true;
     }
 }
 
 unsigned long WINAPI ThreadedJobQueue::StaticThreadCallback(
-    void* voidThis)
+    void* voidWorker)
 {
-    ThreadedJobQueue* threadedJobQueue = reinterpret_cast<ThreadedJobQueue*>(voidThis);
-    threadedJobQueue->ThreadCallback();
+    Worker* worker = reinterpret_cast<Worker*>(voidWorker);
+    worker->owner->ThreadCallback(*worker);
 
     return 0;
 }
 
-void ThreadedJobQueue::ThreadCallback()
+void ThreadedJobQueue::ThreadCallback(
+    Worker& worker)
 {
     TraceThreadedJobQueueThreadLifetimeBegin(reinterpret_cast<uint64_t>(this));
     auto traceEtwOnExit = wil::scope_exit([&]
@@ -202,7 +339,7 @@ void ThreadedJobQueue::ThreadCallback()
 
     const std::chrono::milliseconds ThreadTimeoutMs(1000);
 
-    ASSERT(m_threadInterrupt.get() != nullptr);
+    ASSERT(worker.threadInterrupt.get() != nullptr);
 
     // Setup the thread to be able to use COM and setup some variable state
     // so a mutex lock isn't necessary for some variables.
@@ -231,7 +368,7 @@ void ThreadedJobQueue::ThreadCallback()
             break;
         }
 
-        threadInterruptHandle = m_threadInterrupt.get();
+        threadInterruptHandle = worker.threadInterrupt.get();
     }
 
     auto comUninitializeOnExit = wil::scope_exit([&comInitialized]
@@ -250,6 +387,11 @@ void ThreadedJobQueue::ThreadCallback()
         DestroyWindow(hwnd);
     });
 
+    {
+        std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
+        worker.hwnd = hwnd;
+    }
+
     // Run the thread keep alive loop looking for work or shutdown request.
     do
     {
@@ -264,19 +406,20 @@ void ThreadedJobQueue::ThreadCallback()
             ProcessMessagePump();
         }
 
-        // Step 2: Check the queue and terminate on inactivity
+        // Step 2: Check the queues and terminate on inactivity
         {
             std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
-            queueEmpty = m_jobQueue.empty();
+            queueEmpty = !TryTakeJob(worker, &job);
             if (queueEmpty)
             {
                 if (m_keepAliveCount == 0)
                 {
                     // If there hasn't been a job for a certain amount of time, shut down the thread.
-                    auto diffTime = Jupiter::HighResolutionClock::now() - m_lastJobTime;
+                    auto diffTime = Jupiter::HighResolutionClock::now() - worker.lastJobTime;
                     if (diffTime > ThreadTimeoutMs)
                     {
-                        m_isThreadActive = false;
+                        worker.isThreadActive = false;
+                        worker.hwnd = nullptr;
 
                         // Terminate the thread
                         return;
@@ -285,9 +428,7 @@ void ThreadedJobQueue::ThreadCallback()
             }
             else
             {
-                // Pop an entry
-                job = std::move(m_jobQueue.front());
-                m_jobQueue.pop_front();
+                worker.isRunningJob = true;
             }
         }
 
@@ -312,7 +453,8 @@ void ThreadedJobQueue::ThreadCallback()
                 // time doesn't contribute to the timeout when checking how long
                 // the queue has been empty.
                 std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
-                m_lastJobTime = Jupiter::HighResolutionClock::now();
+                worker.lastJobTime = Jupiter::HighResolutionClock::now();
+                worker.isRunningJob = false;
             }
         }
 
@@ -344,7 +486,8 @@ void ThreadedJobQueue::ThreadCallback()
                 std::lock_guard<std::recursive_mutex> guard(m_jobMutex);
                 if (m_shutdown)
                 {
-                    m_isThreadActive = false;
+                    worker.isThreadActive = false;
+                    worker.hwnd = nullptr;
 
                     // Terminate the thread
                     return;
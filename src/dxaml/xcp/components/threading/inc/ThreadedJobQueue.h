@@ -7,14 +7,18 @@
 #include <functional>
 #include <queue>
 #include <mutex>
+#include <memory>
+#include <vector>
 #include <wil\resource.h>
 #include <Clock.h>
 
 class ThreadedJobQueueDeferral;
 
-// This class provides functionality to run jobs on another thread.  There will only
-// be one thread to run the jobs.
-// The thread will also be created if hasn't already to run the queued jobs.
+// This class provides functionality to run jobs on other threads.  By default there will only
+// be one thread to run the jobs, but the queue can be given a pool of worker threads.
+// Each worker has its own queue of jobs, and a worker that runs out of work takes jobs
+// from the back of another worker's queue.
+// Worker threads are created as jobs are queued, if they haven't been already.
 class ThreadedJobQueue final
 {
     friend class ThreadedJobQueueDeferral;
@@ -32,18 +36,37 @@ public:
         ComMultiThreadedApartment,
     };
 
-    // If terminateOnInactivity is specified, it will terminate after a period of inactivity otherwise
+    // High priority jobs run before the normal priority jobs already queued on the same worker.
+    enum class JobPriority
+    {
+        Normal,
+        High,
+    };
+
+    // If terminateOnInactivity is specified, each thread will terminate after a period of inactivity otherwise
     // it will only terminate when the object is destroyed.
+    // Jobs run on up to maxThreadCount threads.
     ThreadedJobQueue(
         ThreadingModel threadingModel,
-        bool terminateOnInactivity = true);
+        bool terminateOnInactivity = true,
+        uint32_t maxThreadCount = 1);
     ~ThreadedJobQueue();
 
     // Queue a job which will run on another thread.
     // Jobs should stow an exception or fail fast.  Alternatively,
     // they can use their own error reporting mechanism via lambda captures
     // or function objects.
-    void QueueJob(std::function<void(HWND hwnd)> job);
+    void QueueJob(
+        std::function<void(HWND hwnd)> job,
+        JobPriority priority = JobPriority::Normal);
+
+    // Queue a job which will run on the same thread as the job that was given hwnd, for work that depends
+    // on that thread's apartment or message pump.  The job is never moved to another thread.  The caller
+    // must hold a deferral so that thread is still alive.
+    void QueueJobForWindow(
+        HWND hwnd,
+        std::function<void(HWND hwnd)> job,
+        JobPriority priority = JobPriority::Normal);
 
     // Gets an RAII style deferral object that will keep the thread alive and running as long as the object
     // is kept around.  It is the callers responsibility to ensure all deferral objects are cleaned up
@@ -51,25 +74,41 @@ public:
     wistd::unique_ptr<ThreadedJobQueueDeferral> GetDeferral();
 
 private:
+    struct Job
+    {
+        std::function<void(HWND)> callback;
+        bool canMoveToOtherWorker;
+    };
+
+    struct Worker
+    {
+        ThreadedJobQueue* owner = nullptr;
+        std::deque<Job> jobQueue;
+        wil::unique_handle jobThread;
+        wil::unique_handle threadInterrupt;
+        Jupiter::HighResolutionClock::time_point lastJobTime;
+        HWND hwnd = nullptr;
+        bool isThreadActive = false;
+        bool isRunningJob = false;
+    };
 
     // Optional methods to track external dependencies on the thread such as waiting for the message pump
     // in ComSingleThreadedApartment mode.
     void IncrementDeferredKeepAliveCount();
     void DecrementDeferredKeepAliveCount();
 
-    void EnsureThreadActive();
+    void QueueJobOnWorker(Worker& worker, Job job, JobPriority priority);
+    Worker& ChooseWorker();
+    void EnsureThreadActive(Worker& worker);
+    bool TryTakeJob(Worker& worker, _Out_ std::function<void(HWND)>* job);
 
     static unsigned long WINAPI StaticThreadCallback(void*);
-    void ThreadCallback();
+    void ThreadCallback(Worker& worker);
 
     std::recursive_mutex m_jobMutex;
     ThreadingModel m_threadingModel = ThreadingModel::Simple;
-    std::deque<std::function<void(HWND)>> m_jobQueue;
-    wil::unique_handle m_jobThread;
-    wil::unique_handle m_threadInterrupt;
-    Jupiter::HighResolutionClock::time_point m_lastJobTime;
+    std::vector<std::unique_ptr<Worker>> m_workers;
     bool m_shutdown = false;
-    bool m_isThreadActive = false;
     uint32_t m_keepAliveCount = 0;
 };
 
@@ -40,14 +40,13 @@ namespace {
         }
     }
 
-    bool HasMatchingDynamicTimeline(_In_ const TimelineLookupList& transitionAnimations,
+    bool HasMatchingDynamicTimeline(_In_ const TimelineLookupList::NodeKeySet& transitionDynamicTimelines,
         _In_ const TimelineLookupList::Node& dynamicTimelineNode)
     {
-        for (const auto& transitionNode : transitionAnimations)
+        auto matches = transitionDynamicTimelines.equal_range(&dynamicTimelineNode);
+        for (auto it = matches.first; it != matches.second; ++it)
         {
-            if (transitionNode.m_dynamicTimeline &&
-                dynamicTimelineNode == transitionNode &&
-                dynamicTimelineNode.m_dynamicTimeline->GetTypeIndex() == transitionNode.m_dynamicTimeline->GetTypeIndex())
+            if (dynamicTimelineNode.m_dynamicTimeline->GetTypeIndex() == (*it)->m_dynamicTimeline->GetTypeIndex())
             {
                 return true;
             }
@@ -76,11 +75,22 @@ namespace {
         // that matches this value, we skip it, as we're in a run of expanded storyboards.
         CDynamicTimeline* lastSeen = nullptr;
 
+        // Index the transition's dynamic timelines by target and property once,
+        // rather than scanning the whole transition for every new state node.
+        TimelineLookupList::NodeKeySet transitionDynamicTimelines;
+        for (const auto& transitionNode : transitionAnimations)
+        {
+            if (transitionNode.m_dynamicTimeline)
+            {
+                transitionDynamicTimelines.insert(&transitionNode);
+            }
+        }
+
         for (const auto& node : newStateAnimations)
         {
             if (node.m_dynamicTimeline &&
                 lastSeen != node.m_dynamicTimeline &&
-                !HasMatchingDynamicTimeline(transitionAnimations, node))
+                !HasMatchingDynamicTimeline(transitionDynamicTimelines, node))
             {
                 lastSeen = node.m_dynamicTimeline;
                 xref_ptr<CTimelineCollection> generatedChildren;
@@ -584,30 +594,18 @@ namespace DynamicTransitionStoryboardGenerator {
         durationCValue.Wrap<valueVO>(duration);
         IFC_RETURN(storyboard->SetValueByIndex(KnownPropertyIndex::Timeline_Duration, durationCValue));
 
-        for (const auto& node : currentSetters)
-        {
-            currentAnimations.RemoveMatchingNodes(node);
-        }
+        currentAnimations.RemoveMatchingNodes(currentSetters);
 
-        for (const auto& node : transitionAnimations)
-        {
-            currentAnimations.RemoveMatchingNodes(node);
-            currentSetters.RemoveMatchingNodes(node);
-            newStateAnimations.RemoveMatchingNodes(node);
-            newStateSetters.RemoveMatchingNodes(node);
-        }
+        currentAnimations.RemoveMatchingNodes(transitionAnimations);
+        currentSetters.RemoveMatchingNodes(transitionAnimations);
+        newStateAnimations.RemoveMatchingNodes(transitionAnimations);
+        newStateSetters.RemoveMatchingNodes(transitionAnimations);
 
-        for (const auto& node : newStateAnimations)
-        {
-            currentAnimations.RemoveMatchingNodes(node);
-            currentSetters.RemoveMatchingNodes(node);
-        }
+        currentAnimations.RemoveMatchingNodes(newStateAnimations);
+        currentSetters.RemoveMatchingNodes(newStateAnimations);
 
-        for (const auto& node : newStateSetters)
-        {
-            currentAnimations.RemoveMatchingNodes(node);
-            currentSetters.RemoveMatchingNodes(node);
-        }
+        currentAnimations.RemoveMatchingNodes(newStateSetters);
+        currentSetters.RemoveMatchingNodes(newStateSetters);
 
         auto timelineGenerationFunc = [&](const TimelineLookupList::Node& node, bool processingCurrentAnimations) {
             if (!node.m_dynamicTimeline)
@@ -3,6 +3,8 @@
 
 #pragma once
 
+#include <unordered_set>
+
 //  Helper class used to represent a pseudo-keyed set of timelines. This class contains
 //  a list of timelines which is created by flattening one or more storyboards. (Flatten because
 //  a storyboard can contain other storyboards...)
@@ -92,6 +94,26 @@ public:
         }
     };
 
+    // Hashes nodes on the same DO/DP pair Node::operator== compares, so a set
+    // of nodes can be probed for matches instead of scanning a whole list.
+    struct NodeKeyHash
+    {
+        std::size_t operator()(_In_ const Node* node) const noexcept
+        {
+            return node->m_doWeakRef.hash() ^ (static_cast<std::size_t>(node->m_propertyIndex) * 0x9e3779b9);
+        }
+    };
+
+    struct NodeKeyEqual
+    {
+        bool operator()(_In_ const Node* left, _In_ const Node* right) const noexcept
+        {
+            return *left == *right;
+        }
+    };
+
+    using NodeKeySet = std::unordered_multiset<const Node*, NodeKeyHash, NodeKeyEqual>;
+
     _Check_return_ HRESULT Initialize(_In_ const std::vector<CStoryboard*>& storyboards)
     {
         IFC_RETURN(FlattenStoryboardList(storyboards));
@@ -182,11 +204,27 @@ public:
         return S_OK;
     }
 
-    // Remove nodes in this list which affect the same DO/DP pairs as
-    // the keyed value from another list
-    void RemoveMatchingNodes(const Node& keyedValue)
+    // Remove nodes in this list which affect the same DO/DP pairs as any
+    // node of another list. The other list is hashed once, so this is linear
+    // in the size of both lists rather than their product.
+    void RemoveMatchingNodes(const TimelineLookupList& other)
     {
-        m_list.erase(std::remove(m_list.begin(), m_list.end(), keyedValue), m_list.end());
+        if (m_list.empty() || other.m_list.empty())
+        {
+            return;
+        }
+
+        NodeKeySet otherKeys(other.m_list.size());
+        for (const auto& node : other.m_list)
+        {
+            otherKeys.insert(&node);
+        }
+
+        m_list.erase(
+            std::remove_if(m_list.begin(), m_list.end(), [&otherKeys](const Node& node) {
+                return otherKeys.find(&node) != otherKeys.end();
+            }),
+            m_list.end());
     }
 
     std::vector<Node>::const_iterator begin() const { return m_list.begin(); }
@@ -4,6 +4,7 @@
 #include "precomp.hpp"
 #include <ThreadedJobQueue.h>
 #include <wil\resource.h>
+#include <thread>
 #include "corep.h"
 
 //-------------------------------------------------------------------------
@@ -638,7 +639,8 @@ ThreadedJobQueue& CDownloader::GetJobQueue()
         // This queue is meant for urlmon so it requires COM SingleThreadedApartment usage.
         m_threadedJobQueue = wil::make_unique_failfast<ThreadedJobQueue>(
             ThreadedJobQueue::ThreadingModel::ComSingleThreadedApartment,
-            true /* terminateOnInactivity */);
+            true /* terminateOnInactivity */,
+            std::min(std::max(std::thread::hardware_concurrency(), 1u), 4u) /* maxThreadCount */);
     }
 
     return *m_threadedJobQueue;
@@ -618,6 +618,7 @@ _Check_return_ HRESULT XamlNativeRuntime::InitializationGuard(
         else
         {
             IFC_RETURN(pDependencyObject->CreationComplete());
+            pDependencyObject->RecordSparseValueTableSize();
             pDependencyObject->ResetParserParentLock();
             pDependencyObject->SetIsParsing(FALSE);
         }
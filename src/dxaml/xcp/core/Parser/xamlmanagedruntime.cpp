@@ -302,6 +302,7 @@ _Check_return_ HRESULT XamlManagedRuntime::InitializationGuard(
             bool bIsISupportInitialize = false;
 
             IFC_RETURN(pDependencyObject->CreationComplete());
+            pDependencyObject->RecordSparseValueTableSize();
             IFC_RETURN(spXamlType->IsISupportInitialize(bIsISupportInitialize));
 
             if (bIsISupportInitialize)
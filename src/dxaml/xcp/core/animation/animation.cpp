@@ -272,83 +272,67 @@ _Check_return_ HRESULT CAnimation::UpdateAnimationUsingKeyFrames(bool isIndepend
     }
 #endif
 
-    // Set the end points of the interpolation to the base value
-    IFC_RETURN(ValueAssign(AssignmentOperand::From, AssignmentOperand::BaseValue));
-    IFC_RETURN(ValueAssign(AssignmentOperand::To, AssignmentOperand::BaseValue));
+    EnsureKeyFramePercents(sortedKeyFrames);
 
-    // Set the From Value to either the first keyframe or the base value
-    pKeyFrame = static_cast<CKeyFrame*>(sortedKeyFrames[0]);
-    if (pKeyFrame->m_keyTime->Value().GetPercent() > 0)
+    // Find the segment being interpolated: the number of key frames whose key time has been reached.
+    nCurrentSegment = GetKeyFrameSegment(m_rCurrentProgress);
+
+    // Set the From value to the last key frame reached. Before the first key frame, we interpolate
+    // from the base value, unless the first key frame is at time=0.
+    if (nCurrentSegment > 0)
     {
-        // If the first time is non-zero, we interpolate from the base value
-        rSegmentPercentSpan = pKeyFrame->m_keyTime->Value().GetPercent();
+        pKeyFrame = static_cast<CKeyFrame*>(sortedKeyFrames[nCurrentSegment - 1]);
+        IFC_RETURN(pKeyFrame->GetValue(m_pDPValue, &value));
+        IFC_RETURN(ValueAssign(AssignmentOperand::From, value));
+        rCumulativePercentSpan = m_keyFramePercents[nCurrentSegment - 1];
+    }
+    else if (m_keyFramePercents[0] > 0)
+    {
+        IFC_RETURN(ValueAssign(AssignmentOperand::From, AssignmentOperand::BaseValue));
     }
     else
     {
-        // If the first keyframe is at time=0, we interpolate from the first keyfame
+        pKeyFrame = static_cast<CKeyFrame*>(sortedKeyFrames[0]);
         IFC_RETURN(pKeyFrame->GetValue(m_pDPValue, &value));
         IFC_RETURN(ValueAssign(AssignmentOperand::From, value));
     }
 
-    // Set the To Value to be the first keyframe
-    IFC_RETURN(pKeyFrame->GetValue(m_pDPValue, &value));
-    IFC_RETURN(ValueAssign(AssignmentOperand::To, value));
-
-    // Per-KeyFrame Segment value computation: check that we are interpolating between the correct
-    //      keyframe values.
-    while (nCurrentSegment < frameCount
-        && static_cast<CKeyFrame*>(sortedKeyFrames[nCurrentSegment])->m_keyTime->Value().GetPercent() <= m_rCurrentProgress)
+    // Set the To value to the next key frame. We need to hold the last value for the time after the
+    // last segment.
+    if (nCurrentSegment < frameCount)
+    {
+        pKeyFrame = static_cast<CKeyFrame*>(sortedKeyFrames[nCurrentSegment]);
+        rSegmentPercentSpan = m_keyFramePercents[nCurrentSegment] - rCumulativePercentSpan;
+    }
+    else
     {
-    // Move to the next segment
-        nCurrentSegment++;
-        IFC_RETURN(ValueAssign(AssignmentOperand::From, AssignmentOperand::To));
-        rCumulativePercentSpan += rSegmentPercentSpan;
+        pKeyFrame = static_cast<CKeyFrame*>(sortedKeyFrames[frameCount - 1]);
 
-    // Check to see if we are at the end
-        if (nCurrentSegment < frameCount)
+        if (rCumulativePercentSpan < 1.0f)
         {
-            pKeyFrame = static_cast<CKeyFrame*>(sortedKeyFrames[nCurrentSegment]);
-            IFC_RETURN(pKeyFrame->GetValue(m_pDPValue, &value));
-            IFC_RETURN(ValueAssign(AssignmentOperand::To, value));
-            rSegmentPercentSpan = pKeyFrame->m_keyTime->Value().GetPercent() - rCumulativePercentSpan;
+            rSegmentPercentSpan = 1.0f - rCumulativePercentSpan;
         }
         else
         {
-        // We need to hold the last value for the time after the last segment
-            pKeyFrame = static_cast<CKeyFrame*>(sortedKeyFrames[frameCount - 1]);
-            IFC_RETURN(pKeyFrame->GetValue(m_pDPValue, &value));
-            IFC_RETURN(ValueAssign(AssignmentOperand::To, value));
-
-            if (rCumulativePercentSpan < 1.0f)
-            {
-                rSegmentPercentSpan = 1.0f - rCumulativePercentSpan;
-            }
-            else
-            {
-                // We may be at the case that this is the last segment at the end time,
-                //   so the effective duration of the interval is zero.  Override this
-                //   to prevent a divide by zero later.
-                rSegmentPercentSpan = 1.0f;
-            }
+            // We may be at the case that this is the last segment at the end time,
+            //   so the effective duration of the interval is zero.  Override this
+            //   to prevent a divide by zero later.
+            rSegmentPercentSpan = 1.0f;
         }
     }
 
+    IFC_RETURN(pKeyFrame->GetValue(m_pDPValue, &value));
+    IFC_RETURN(ValueAssign(AssignmentOperand::To, value));
+
     // Progress computation: scale the overall progress to this particular keyframe segment
     //      and apply any time-compresion due to keysplines on a per keyframe basis.
 
     // Compute the linear progress of this segment
     rSegmentProgress = (m_rCurrentProgress - rCumulativePercentSpan) / rSegmentPercentSpan;
 
-    // Now interpolate according to the current keyframe type
-    if (nCurrentSegment < frameCount)
-    {
-        rSegmentProgress = static_cast<CKeyFrame*>(sortedKeyFrames[nCurrentSegment])->GetEffectiveProgress(rSegmentProgress);
-    }
-    else
-    {
-    // We are dealing with the last segment or single segment, hold that last value
-        rSegmentProgress = static_cast<CKeyFrame*>(sortedKeyFrames[frameCount - 1])->GetEffectiveProgress(rSegmentProgress);
-    }
+    // Now interpolate according to the current keyframe type. Past the last segment, this is the last
+    // key frame, whose value we hold.
+    rSegmentProgress = pKeyFrame->GetEffectiveProgress(rSegmentProgress);
 
     InterpolateCurrentValue(rSegmentProgress);
     PostInterpolateValues();
@@ -386,11 +370,10 @@ _Check_return_ HRESULT CAnimation::RequestNextTickForKeyFrames(
 
         FAIL_FAST_ASSERT(frameCount == m_pKeyFrames->GetCount());
 
-        XUINT32 nCurrentSegment = 0;
-        while (nCurrentSegment < frameCount && (static_cast<CKeyFrame*>(sortedKeyFrames[nCurrentSegment]))->m_keyTime->Value().GetPercent() <= m_rCurrentProgress)
-        {
-             nCurrentSegment++;
-        }
+        EnsureKeyFramePercents(sortedKeyFrames);
+
+        // This tick has already found the segment while updating the value, so the cursor is on it.
+        const XUINT32 nCurrentSegment = GetKeyFrameSegment(m_rCurrentProgress);
 
         // If current progress is within a continuously-interpolated key-frame segment, request an immediate tick.
         if (nCurrentSegment < frameCount && !(static_cast<CKeyFrame*>(sortedKeyFrames[nCurrentSegment]))->IsDiscrete())
@@ -427,7 +410,7 @@ _Check_return_ HRESULT CAnimation::RequestNextTickForKeyFrames(
                 // The target is one of the key-frame's key-times.
                 ASSERT(targetSegment >= 0 && static_cast<XUINT32>(targetSegment) < frameCount);
 
-                XFLOAT keyTimeProgress = (static_cast<CKeyFrame*>(sortedKeyFrames[targetSegment]))->m_keyTime->Value().GetPercent();
+                XFLOAT keyTimeProgress = m_keyFramePercents[targetSegment];
 
                 // Convert from progress percentage back in millisecond interval.
                 targetTime = keyTimeProgress * durationValue;
@@ -455,6 +438,52 @@ _Check_return_ HRESULT CAnimation::RequestNextTickForKeyFrames(
     return S_OK;
 }
 
+// Caches the key time percentages of the sorted key frames, so ticks can find their segment without
+// going through every key frame passed so far. The key frames can't be added or removed while the
+// animation is active, and their percentages are only resolved on Begin.
+void CAnimation::EnsureKeyFramePercents(const CDOCollection::storage_type& sortedKeyFrames)
+{
+    if (m_keyFramePercents.size() != sortedKeyFrames.size())
+    {
+        m_keyFramePercents.clear();
+        m_keyFramePercents.reserve(sortedKeyFrames.size());
+
+        for (auto& kf : sortedKeyFrames)
+        {
+            m_keyFramePercents.push_back(static_cast<CKeyFrame*>(kf)->m_keyTime->Value().GetPercent());
+        }
+
+        m_keyFrameSegmentCursor = 0;
+    }
+}
+
+// Returns the number of key frames whose key time is at or before the given progress. Progress usually
+// moves forward by a segment or less between ticks, so start from the segment found last time and only
+// binary search after a seek, a reversal, or a jump over many short segments.
+XUINT32 CAnimation::GetKeyFrameSegment(XFLOAT rProgress)
+{
+    const XUINT32 frameCount = static_cast<XUINT32>(m_keyFramePercents.size());
+    XUINT32 segment = std::min(m_keyFrameSegmentCursor, frameCount);
+
+    for (XUINT32 step = 0; step < 2 && segment < frameCount && m_keyFramePercents[segment] <= rProgress; step++)
+    {
+        segment++;
+    }
+
+    if ((segment > 0 && !(m_keyFramePercents[segment - 1] <= rProgress))
+        || (segment < frameCount && m_keyFramePercents[segment] <= rProgress))
+    {
+        segment = static_cast<XUINT32>(std::partition_point(
+            m_keyFramePercents.begin(),
+            m_keyFramePercents.end(),
+            [rProgress](XFLOAT percent) { return percent <= rProgress; }) - m_keyFramePercents.begin());
+    }
+
+    m_keyFrameSegmentCursor = segment;
+
+    return segment;
+}
+
 // Perform begin time initializations
 _Check_return_ HRESULT CAnimation::OnBegin()
 {
@@ -583,6 +612,10 @@ _Check_return_ HRESULT CAnimation::OnBegin()
 
         // Make sure our keyframes are initialized to the expected state
         IFC(m_pKeyFrames->InitializeKeyFrames(rNaturalDuration));
+
+        // The key time percentages may have changed, so resolve them again on the next tick.
+        m_keyFramePercents.clear();
+        m_keyFrameSegmentCursor = 0;
     }
 
     //
@@ -0,0 +1,275 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "ChildBoundsGrid.h"
+#include "HitTestPolygon.h"
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Buckets the children into the cells their outer bounds overlap.
+//  The children's bounds must be clean, which they are whenever the
+//  parent's child bounds are.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+ChildBoundsGrid::Build(
+    _In_reads_(childCount) CUIElement* const* ppChildren,
+    XUINT32 childCount
+    )
+{
+    std::vector<XRECTF_RB> childBounds(childCount);
+    std::vector<bool> isGridded(childCount, false);
+    XUINT32 cGridded = 0;
+
+    m_children.assign(ppChildren, ppChildren + childCount);
+    m_alwaysTested.clear();
+
+    for (XUINT32 i = 0; i < childCount; ++i)
+    {
+        CUIElement* pChild = ppChildren[i];
+
+        // Null entries are skipped by the bounds walk, see CUIElement::BoundsTestChildrenImpl.
+        if (pChild == nullptr)
+        {
+            continue;
+        }
+
+        // These children aren't culled by their outer bounds, or don't have outer bounds
+        // computed for them by the parent. See CUIElement::GenerateChildOuterBounds.
+        if (pChild->GetTypeIndex() == KnownTypeIndex::Popup
+            || pChild->IsHiddenForLayoutTransition()
+            || pChild->HasDepthLegacy()
+            || pChild->Has3DDepthOnSelfOrSubtree())
+        {
+            m_alwaysTested.push_back(i);
+            continue;
+        }
+
+        XRECTF_RB& bounds = childBounds[i];
+        IFC_RETURN(pChild->GetOuterBounds(nullptr /* hitTestParams */, &bounds));
+
+        if (!(bounds.right >= bounds.left && bounds.bottom >= bounds.top))
+        {
+            // Empty (or NaN) bounds never intersect a target.
+            continue;
+        }
+
+        if (!IsFiniteF(bounds.left) || !IsFiniteF(bounds.top) || !IsFiniteF(bounds.right) || !IsFiniteF(bounds.bottom))
+        {
+            m_alwaysTested.push_back(i);
+            continue;
+        }
+
+        if (cGridded == 0)
+        {
+            m_bounds = bounds;
+        }
+        else
+        {
+            UnionRectF(&m_bounds, &bounds);
+        }
+
+        isGridded[i] = true;
+        cGridded++;
+    }
+
+    // Aim for a few children per cell.
+    const XUINT32 cellsPerSide = std::min(
+        std::max(static_cast<XUINT32>(sqrtf(cGridded / 4.0f)), 1u),
+        s_maxCellsPerSide);
+    const XFLOAT width = m_bounds.right - m_bounds.left;
+    const XFLOAT height = m_bounds.bottom - m_bounds.top;
+
+    m_columns = (width > 0.0f) ? cellsPerSide : 1;
+    m_rows = (height > 0.0f) ? cellsPerSide : 1;
+    m_cellWidth = (width > 0.0f) ? width / m_columns : 1.0f;
+    m_cellHeight = (height > 0.0f) ? height / m_rows : 1.0f;
+
+    m_cellStarts.assign(m_columns * m_rows + 1, 0);
+
+    for (XUINT32 i = 0; i < childCount; ++i)
+    {
+        if (isGridded[i])
+        {
+            const XRECTF_RB& bounds = childBounds[i];
+            const XUINT32 firstColumn = GetColumn(bounds.left);
+            const XUINT32 lastColumn = GetColumn(bounds.right);
+            const XUINT32 firstRow = GetRow(bounds.top);
+            const XUINT32 lastRow = GetRow(bounds.bottom);
+
+            if ((lastColumn - firstColumn + 1) * (lastRow - firstRow + 1) > s_maxCellsPerChild)
+            {
+                isGridded[i] = false;
+                m_alwaysTested.push_back(i);
+                continue;
+            }
+
+            for (XUINT32 row = firstRow; row <= lastRow; ++row)
+            {
+                for (XUINT32 column = firstColumn; column <= lastColumn; ++column)
+                {
+                    m_cellStarts[row * m_columns + column + 1]++;
+                }
+            }
+        }
+    }
+
+    for (XUINT32 cell = 0; cell < m_columns * m_rows; ++cell)
+    {
+        m_cellStarts[cell + 1] += m_cellStarts[cell];
+    }
+
+    m_cellChildren.resize(m_cellStarts[m_columns * m_rows]);
+
+    std::vector<XUINT32> next(m_cellStarts.begin(), m_cellStarts.end() - 1);
+
+    for (XUINT32 i = 0; i < childCount; ++i)
+    {
+        if (isGridded[i])
+        {
+            const XRECTF_RB& bounds = childBounds[i];
+            const XUINT32 firstColumn = GetColumn(bounds.left);
+            const XUINT32 lastColumn = GetColumn(bounds.right);
+            const XUINT32 firstRow = GetRow(bounds.top);
+            const XUINT32 lastRow = GetRow(bounds.bottom);
+
+            for (XUINT32 row = firstRow; row <= lastRow; ++row)
+            {
+                for (XUINT32 column = firstColumn; column <= lastColumn; ++column)
+                {
+                    m_cellChildren[next[row * m_columns + column]++] = i;
+                }
+            }
+        }
+    }
+
+    // Keep the always tested children in render order, like the cells.
+    std::sort(m_alwaysTested.begin(), m_alwaysTested.end());
+
+    return S_OK;
+}
+
+XUINT32
+ChildBoundsGrid::GetColumn(
+    XFLOAT x
+    ) const
+{
+    const XFLOAT offset = (x - m_bounds.left) / m_cellWidth;
+
+    if (!(offset > 0.0f))
+    {
+        return 0;
+    }
+
+    return std::min(static_cast<XUINT32>(offset), m_columns - 1);
+}
+
+XUINT32
+ChildBoundsGrid::GetRow(
+    XFLOAT y
+    ) const
+{
+    const XFLOAT offset = (y - m_bounds.top) / m_cellHeight;
+
+    if (!(offset > 0.0f))
+    {
+        return 0;
+    }
+
+    return std::min(static_cast<XUINT32>(offset), m_rows - 1);
+}
+
+bool
+ChildBoundsGrid::GetCandidates(
+    const XPOINTF& target,
+    _In_reads_(childCount) CUIElement* const* ppChildren,
+    XUINT32 childCount,
+    _Out_ std::vector<XUINT32>* pCandidates
+    ) const
+{
+    const XRECTF_RB targetBounds = { target.x, target.y, target.x, target.y };
+
+    return GetCandidatesInRect(targetBounds, ppChildren, childCount, pCandidates);
+}
+
+bool
+ChildBoundsGrid::GetCandidates(
+    const HitTestPolygon& target,
+    _In_reads_(childCount) CUIElement* const* ppChildren,
+    XUINT32 childCount,
+    _Out_ std::vector<XUINT32>* pCandidates
+    ) const
+{
+    if (target.IsEmpty())
+    {
+        pCandidates->assign(m_alwaysTested.rbegin(), m_alwaysTested.rend());
+
+        return childCount == m_children.size();
+    }
+
+    return GetCandidatesInRect(target.GetPolygonBounds(), ppChildren, childCount, pCandidates);
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Collects the children of every cell the target bounds overlap plus
+//      the children that are always tested, then validates them against
+//      the current render order.
+//
+//------------------------------------------------------------------------
+bool
+ChildBoundsGrid::GetCandidatesInRect(
+    const XRECTF_RB& targetBounds,
+    _In_reads_(childCount) CUIElement* const* ppChildren,
+    XUINT32 childCount,
+    _Out_ std::vector<XUINT32>* pCandidates
+    ) const
+{
+    pCandidates->assign(m_alwaysTested.begin(), m_alwaysTested.end());
+
+    if (childCount != m_children.size())
+    {
+        return false;
+    }
+
+    if (!m_cellChildren.empty() &&
+        targetBounds.right >= m_bounds.left && targetBounds.left <= m_bounds.right &&
+        targetBounds.bottom >= m_bounds.top && targetBounds.top <= m_bounds.bottom)
+    {
+        const XUINT32 firstColumn = GetColumn(targetBounds.left);
+        const XUINT32 lastColumn = GetColumn(targetBounds.right);
+        const XUINT32 firstRow = GetRow(targetBounds.top);
+        const XUINT32 lastRow = GetRow(targetBounds.bottom);
+
+        for (XUINT32 row = firstRow; row <= lastRow; ++row)
+        {
+            for (XUINT32 column = firstColumn; column <= lastColumn; ++column)
+            {
+                const XUINT32 cell = row * m_columns + column;
+
+                pCandidates->insert(
+                    pCandidates->end(),
+                    m_cellChildren.begin() + m_cellStarts[cell],
+                    m_cellChildren.begin() + m_cellStarts[cell + 1]);
+            }
+        }
+    }
+
+    // Front to back, without the duplicates of children spanning several cells.
+    std::sort(pCandidates->begin(), pCandidates->end(), std::greater<XUINT32>());
+    pCandidates->erase(std::unique(pCandidates->begin(), pCandidates->end()), pCandidates->end());
+
+    // Children may have been reordered (e.g. Canvas.ZIndex) without their bounds changing.
+    for (XUINT32 position : *pCandidates)
+    {
+        if (ppChildren[position] != m_children[position])
+        {
+            return false;
+        }
+    }
+
+    return true;
+}
@@ -0,0 +1,388 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "FlattenedGeometryEdges.h"
+
+//------------------------------------------------------------------------
+//
+//  Class:  FlattenedEdgeHitTestHelper
+//
+//  Synopsis:
+//      Hit test helper that records the flattened edges it is given
+//  instead of testing them against a target.
+//
+//------------------------------------------------------------------------
+class FlattenedEdgeHitTestHelper final : public HitTestHelper
+{
+    public:
+        FlattenedEdgeHitTestHelper(
+            _In_ FlattenedGeometryEdges* pEdges,
+            XFLOAT tolerance,
+            _In_opt_ const CMILMatrix* pTransform
+            )
+            : HitTestHelper(tolerance, pTransform)
+            , m_pEdges(pEdges)
+        {
+        }
+
+        bool EncounteredNaN() const
+        {
+            return m_encounteredNaN;
+        }
+
+        _Check_return_ HRESULT GetResult(
+            bool *pWasHit
+            ) override
+        {
+            IFCEXPECT_RETURN(!m_encounteredNaN);
+
+            *pWasHit = !m_pEdges->m_edges.empty();
+
+            return S_OK;
+        }
+
+        void Reset(
+            ) override
+        {
+            m_pEdges->m_edges.clear();
+        }
+
+    protected:
+        void AcceptPoint(
+            _In_ const XPOINTF& endPoint
+            ) override
+        {
+            CheckForNaN(endPoint);
+
+            m_pEdges->m_edges.push_back({ m_currentPoint, endPoint });
+
+            m_currentPoint = endPoint;
+        }
+
+    private:
+        FlattenedGeometryEdges* m_pEdges;
+};
+
+//------------------------------------------------------------------------
+//
+//  Class:  FlattenedEdgeGeometrySink
+//
+//  Synopsis:
+//      Geometry sink that flattens the fill of a geometry into edges.
+//  Hollow figures are skipped and every figure is closed, exactly as the
+//  sinks used for hit testing do.
+//
+//------------------------------------------------------------------------
+class FlattenedEdgeGeometrySink final : public HitTestGeometrySink
+{
+    public:
+        FlattenedEdgeGeometrySink(
+            _In_ FlattenedGeometryEdges* pEdges,
+            XFLOAT tolerance,
+            _In_opt_ const CMILMatrix* pTransform
+            )
+            : HitTestGeometrySink()
+            , m_hitTestHelper(pEdges, tolerance, pTransform)
+        {
+            m_pBaseHitTestHelper = &m_hitTestHelper;
+        }
+
+        _Check_return_ HRESULT GetResult(
+            _Out_ bool* pHit
+            ) override
+        {
+            RRETURN(m_hitTestHelper.GetResult(pHit));
+        }
+
+        bool EncounteredNaN() const
+        {
+            return m_hitTestHelper.EncounteredNaN();
+        }
+
+        bool IsAlternateFill() const
+        {
+            return m_fillMode == GeometryFillMode::Alternate;
+        }
+
+    private:
+        FlattenedEdgeHitTestHelper m_hitTestHelper;
+};
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Flattens the fill of the geometry through the given transform and
+//      indexes the resulting edges.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+FlattenedGeometryEdges::Create(
+    _In_ CGeometry* pGeometry,
+    _In_opt_ const CMILMatrix* pTransform,
+    XFLOAT tolerance,
+    _Out_ std::unique_ptr<FlattenedGeometryEdges>* ppEdges
+    )
+{
+    HRESULT hr = S_OK;
+    std::unique_ptr<FlattenedGeometryEdges> pEdges(new FlattenedGeometryEdges());
+    FlattenedEdgeGeometrySink* pSink = NULL;
+
+    if (pTransform != NULL)
+    {
+        pEdges->m_transform = *pTransform;
+    }
+
+    pEdges->m_tolerance = tolerance;
+
+    pSink = new FlattenedEdgeGeometrySink(pEdges.get(), tolerance, pTransform);
+
+    IFC(pGeometry->VisitSink(pSink));
+
+    IFC(pSink->Close());
+
+    pEdges->m_isAlternateFill = pSink->IsAlternateFill();
+    pEdges->m_encounteredNaN = pSink->EncounteredNaN();
+
+    if (!pEdges->m_encounteredNaN)
+    {
+        pEdges->BuildBands();
+    }
+
+    *ppEdges = std::move(pEdges);
+
+Cleanup:
+    ReleaseInterface(pSink);
+
+    RRETURN(hr);
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Returns true if these edges were built for the given transform and
+//      tolerance.
+//
+//------------------------------------------------------------------------
+bool
+FlattenedGeometryEdges::IsValidFor(
+    _In_opt_ const CMILMatrix* pTransform,
+    XFLOAT tolerance
+    ) const
+{
+    if (tolerance != m_tolerance)
+    {
+        return false;
+    }
+
+    return (pTransform != NULL) ? (*pTransform == m_transform) : m_transform.IsIdentity();
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Returns the band containing the given y coordinate, clamped to the
+//      bands in the index.
+//
+//------------------------------------------------------------------------
+XUINT32
+FlattenedGeometryEdges::GetBand(
+    XFLOAT y
+    ) const
+{
+    const XFLOAT offset = (y - m_bounds.top) / m_bandHeight;
+
+    if (!(offset > 0.0f))
+    {
+        return 0;
+    }
+
+    return std::min(static_cast<XUINT32>(offset), m_bandCount - 1);
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Computes the bounds of the edges and buckets every edge into each
+//      band its vertical extent, grown by the tolerance, overlaps.  The
+//      band count starts at one band per few edges and is halved until
+//      tall edges spanning many bands no longer blow up the index.
+//
+//------------------------------------------------------------------------
+void
+FlattenedGeometryEdges::BuildBands()
+{
+    const XUINT32 cEdges = static_cast<XUINT32>(m_edges.size());
+
+    if (cEdges == 0)
+    {
+        return;
+    }
+
+    m_bounds.left = m_bounds.right = m_edges[0].start.x;
+    m_bounds.top = m_bounds.bottom = m_edges[0].start.y;
+
+    for (const Edge& edge : m_edges)
+    {
+        m_bounds.left = std::min(m_bounds.left, std::min(edge.start.x, edge.end.x));
+        m_bounds.right = std::max(m_bounds.right, std::max(edge.start.x, edge.end.x));
+        m_bounds.top = std::min(m_bounds.top, std::min(edge.start.y, edge.end.y));
+        m_bounds.bottom = std::max(m_bounds.bottom, std::max(edge.start.y, edge.end.y));
+    }
+
+    m_bounds.left -= m_tolerance;
+    m_bounds.top -= m_tolerance;
+    m_bounds.right += m_tolerance;
+    m_bounds.bottom += m_tolerance;
+
+    const XFLOAT height = m_bounds.bottom - m_bounds.top;
+    const size_t maxBandEdges = static_cast<size_t>(cEdges) * 8;
+
+    m_bandCount = std::min(std::max(cEdges / 4, 1u), s_maxBandCount);
+
+    for (;;)
+    {
+        m_bandHeight = height / m_bandCount;
+
+        if (!(m_bandHeight > 0.0f))
+        {
+            m_bandCount = 1;
+            m_bandHeight = 1.0f;
+        }
+
+        m_bandStarts.assign(m_bandCount + 1, 0);
+
+        size_t cBandEdges = 0;
+
+        for (const Edge& edge : m_edges)
+        {
+            const XUINT32 firstBand = GetBand(std::min(edge.start.y, edge.end.y) - m_tolerance);
+            const XUINT32 lastBand = GetBand(std::max(edge.start.y, edge.end.y) + m_tolerance);
+
+            cBandEdges += lastBand - firstBand + 1;
+
+            for (XUINT32 band = firstBand; band <= lastBand; ++band)
+            {
+                m_bandStarts[band + 1]++;
+            }
+        }
+
+        if (cBandEdges <= maxBandEdges || m_bandCount == 1)
+        {
+            break;
+        }
+
+        m_bandCount /= 2;
+    }
+
+    for (XUINT32 band = 0; band < m_bandCount; ++band)
+    {
+        m_bandStarts[band + 1] += m_bandStarts[band];
+    }
+
+    m_bandEdges.resize(m_bandStarts[m_bandCount]);
+
+    std::vector<XUINT32> next(m_bandStarts.begin(), m_bandStarts.end() - 1);
+
+    for (XUINT32 i = 0; i < cEdges; ++i)
+    {
+        const Edge& edge = m_edges[i];
+        const XUINT32 firstBand = GetBand(std::min(edge.start.y, edge.end.y) - m_tolerance);
+        const XUINT32 lastBand = GetBand(std::max(edge.start.y, edge.end.y) + m_tolerance);
+
+        for (XUINT32 band = firstBand; band <= lastBand; ++band)
+        {
+            m_bandEdges[next[band]++] = i;
+        }
+    }
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Test if the fill contains the target point.  This is the same test
+//      PointHitTestHelper performs, a point is inside if an edge passes
+//      within the tolerance of it or its winding number selects it under
+//      the fill mode, but only the edges of the band containing the point
+//      are visited.
+//
+//------------------------------------------------------------------------
+bool
+FlattenedGeometryEdges::HitTest(
+    const XPOINTF& target
+    ) const
+{
+    //
+    // Some geometry may not be valid such as have degenerate transforms or infinite
+    // points. In the case they are encountered the geometry is considered not hit.
+    //
+    if (m_encounteredNaN || m_edges.empty())
+    {
+        return false;
+    }
+
+    if (target.x < m_bounds.left || target.x > m_bounds.right ||
+        target.y < m_bounds.top || target.y > m_bounds.bottom)
+    {
+        return false;
+    }
+
+    const XUINT32 band = GetBand(target.y);
+    const XDOUBLE squaredThreshold = m_tolerance * m_tolerance;
+    XINT32 windingNumber = 0;
+
+    for (XUINT32 i = m_bandStarts[band]; i < m_bandStarts[band + 1]; ++i)
+    {
+        const Edge& edge = m_edges[m_bandEdges[i]];
+        const XPOINTF currentPoint = edge.start - target;
+        const XPOINTF endPoint = edge.end - target;
+
+        //
+        // Check if the segment passes near the target.  See
+        // PointHitTestHelper::CheckIfSegmentNearTheOrigin.
+        //
+        if (endPoint * endPoint < squaredThreshold ||
+            currentPoint * currentPoint < squaredThreshold)
+        {
+            return true;
+        }
+
+        XPOINTF vec = endPoint - currentPoint;
+
+        XFLOAT r = vec * vec;
+        XFLOAT t = -(currentPoint * vec);
+
+        if (0 <= t && t <= r)
+        {
+            XPOINTF Pr = currentPoint * r + vec * t;
+
+            if (Pr * Pr < squaredThreshold * r * r)
+            {
+                return true;
+            }
+        }
+
+        //
+        // Count the crossings of the positive x axis.  See
+        // PointHitTestHelper::AcceptPoint.
+        //
+        if (currentPoint.y > 0)
+        {
+            if (endPoint.y <= 0 &&
+                currentPoint.x * endPoint.y - endPoint.x * currentPoint.y >= 0)
+            {
+                windingNumber--;
+            }
+        }
+        else
+        {
+            if (endPoint.y > 0 &&
+                endPoint.x * currentPoint.y - currentPoint.x * endPoint.y >= 0)
+            {
+                windingNumber++;
+            }
+        }
+    }
+
+    return m_isAlternateFill ? ((windingNumber & 1) != 0) : (windingNumber != 0);
+}
@@ -346,7 +346,7 @@ _Check_return_ HRESULT CGrid::MeasureCellsGroup(
         CellCache* cell = &cellCacheVector.m_vector[cellsHead];
         CUIElement* pChild = cell->m_child;
 
-        IFC_RETURN(MeasureCell(pChild, cell->m_rowHeightTypes, cell->m_columnWidthTypes, forceRowToInfinity, rowSpacing, columnSpacing));
+        IFC_RETURN(MeasureCell(pChild, cell->m_rowHeightTypes, cell->m_columnWidthTypes, forceRowToInfinity, rowSpacing, columnSpacing, cell->m_availableSize));
 
         //If a span exists, add to span store for delayed processing. processing is done when
         //all the desired sizes for a given definition index and span value are known.
@@ -428,9 +428,10 @@ _Check_return_ HRESULT CGrid::MeasureCell(
     const CellUnitTypes columnWidthTypes,
     const bool forceRowToInfinity,
     const float rowSpacing,
-    const float columnSpacing)
+    const float columnSpacing,
+    _Out_ XSIZEF& availableSize)
 {
-    XSIZEF availableSize = {};
+    availableSize = {};
 
     if (CellCache::IsAuto(columnWidthTypes) && !CellCache::IsStar(columnWidthTypes))
     {
@@ -964,6 +965,130 @@ void CGrid::EnsureTempDefinitionsStorage(unsigned int minCount)
     memset(m_ppTempDefinitions, 0, minCount * sizeof(CDefinitionBase*));
 }
 
+float CGrid::GetLayoutRoundingScale()
+{
+    return GetUseLayoutRounding() ? GetScaleFactorForLayoutRounding() : 1.0f;
+}
+
+// Attempts to satisfy this measure pass with the results of the previous one. This is possible when the
+// Grid's own inputs and cell assignments are unchanged, and every child, measured with the constraint it
+// received last time, still returns the same desired size: the cell groups sequence, the span distribution
+// and the star resolution would then produce identical results, and the definitions still hold the
+// effective min sizes computed by that pass (ArrangeOverride does not alter them).
+// Typically, a single child invalidated its measure and is re-measured here without affecting its size.
+_Check_return_ HRESULT CGrid::TryMeasureFromCache(
+    const XSIZEF availableSize,
+    const XSIZEF combinedThickness,
+    _In_ const CUIElementCollectionWrapper& children,
+    _Out_ XSIZEF& desiredSize,
+    _Out_ bool* measuredFromCache)
+{
+    *measuredFromCache = false;
+
+    if (!m_measureCache || !m_measureCache->m_isValid)
+    {
+        return S_OK;
+    }
+
+    const MeasureCache& cache = *m_measureCache;
+
+    if (cache.m_availableSize.width != availableSize.width ||
+        cache.m_availableSize.height != availableSize.height ||
+        cache.m_combinedThickness.width != combinedThickness.width ||
+        cache.m_combinedThickness.height != combinedThickness.height ||
+        cache.m_rowSpacing != GetRowSpacing() ||
+        cache.m_columnSpacing != GetColumnSpacing() ||
+        cache.m_useLayoutRounding != !!GetUseLayoutRounding() ||
+        cache.m_layoutRoundingScale != GetLayoutRoundingScale() ||
+        cache.m_entries.size() != children.GetCount())
+    {
+        return S_OK;
+    }
+
+    for (UINT32 childIndex = 0; childIndex < children.GetCount(); childIndex++)
+    {
+        const MeasureCacheEntry& entry = cache.m_entries[childIndex];
+        CUIElement* child = children[childIndex];
+
+        if (entry.m_child != child ||
+            entry.m_rowIndex != GetRowIndex(child) ||
+            entry.m_columnIndex != GetColumnIndex(child) ||
+            entry.m_rowSpan != GetRowSpan(child) ||
+            entry.m_columnSpan != GetColumnSpan(child))
+        {
+            return S_OK;
+        }
+    }
+
+    for (const MeasureCacheEntry& entry : cache.m_entries)
+    {
+        // Children that did not invalidate their measure return immediately since the constraint is unchanged.
+        IFC_RETURN(entry.m_child->Measure(entry.m_availableSize));
+        IFC_RETURN(entry.m_child->EnsureLayoutStorage());
+
+        if (entry.m_child->DesiredSize.width != entry.m_desiredSize.width ||
+            entry.m_child->DesiredSize.height != entry.m_desiredSize.height)
+        {
+            // A complete pass is needed. Children measured so far are only measured again if their
+            // constraint ends up being different.
+            return S_OK;
+        }
+    }
+
+    desiredSize = cache.m_desiredSize;
+    *measuredFromCache = true;
+
+    return S_OK;
+}
+
+// Records the results of a complete measure pass in which each cell was measured once.
+void CGrid::UpdateMeasureCache(
+    const XSIZEF availableSize,
+    const XSIZEF combinedThickness,
+    const XSIZEF desiredSize,
+    _In_ const CellCacheStackVector& cellCacheVector)
+{
+    if (!m_measureCache)
+    {
+        m_measureCache = std::make_unique<MeasureCache>();
+    }
+
+    MeasureCache& cache = *m_measureCache;
+
+    cache.m_availableSize = availableSize;
+    cache.m_combinedThickness = combinedThickness;
+    cache.m_desiredSize = desiredSize;
+    cache.m_rowSpacing = GetRowSpacing();
+    cache.m_columnSpacing = GetColumnSpacing();
+    cache.m_useLayoutRounding = !!GetUseLayoutRounding();
+    cache.m_layoutRoundingScale = GetLayoutRoundingScale();
+    cache.m_entries.clear();
+    cache.m_entries.reserve(cellCacheVector.m_vector.size());
+
+    for (const CellCache& cell : cellCacheVector.m_vector)
+    {
+        CUIElement* child = cell.m_child;
+        MeasureCacheEntry entry = {};
+
+        if (!child->GetLayoutStorage())
+        {
+            return;
+        }
+
+        entry.m_child = child;
+        entry.m_rowIndex = GetRowIndex(child);
+        entry.m_columnIndex = GetColumnIndex(child);
+        entry.m_rowSpan = GetRowSpan(child);
+        entry.m_columnSpan = GetColumnSpan(child);
+        entry.m_availableSize = cell.m_availableSize;
+        entry.m_desiredSize = child->DesiredSize;
+
+        cache.m_entries.push_back(entry);
+    }
+
+    cache.m_isValid = true;
+}
+
 
 //------------------------------------------------------------------------
 //
@@ -1019,6 +1144,20 @@ _Check_return_ HRESULT CGrid::MeasureOverride(XSIZEF availableSize, XSIZEF& desi
             IFC_RETURN(InitializeDefinitionStructure());
         }
 
+        auto children = GetUnsortedChildren();
+        UINT32 childrenCount = children.GetCount();
+
+        bool measuredFromCache = false;
+        IFC_RETURN(TryMeasureFromCache(availableSize, combinedThickness, children, desiredSize, &measuredFromCache));
+
+        if (measuredFromCache)
+        {
+            return S_OK;
+        }
+
+        // Invalidated until this pass completes.
+        InvalidateMeasureCache();
+
         ValidateDefinitions(m_pRows, innerAvailableSize.height == std::numeric_limits<float>::infinity() /* treatStarAsAuto */);
         ValidateDefinitions(m_pColumns, innerAvailableSize.width == std::numeric_limits<float>::infinity() /* treatStarAsAuto */);
 
@@ -1029,9 +1168,6 @@ _Check_return_ HRESULT CGrid::MeasureOverride(XSIZEF availableSize, XSIZEF& desi
         innerAvailableSize.width -= combinedColumnSpacing;
         innerAvailableSize.height -= combinedRowSpacing;
 
-        auto children = GetUnsortedChildren();
-        UINT32 childrenCount = children.GetCount();
-
         CellCacheStackVector cellCacheVector;
         CellGroups cellGroups = ValidateCells(children, cellCacheVector);
 
@@ -1234,8 +1370,19 @@ _Check_return_ HRESULT CGrid::MeasureOverride(XSIZEF availableSize, XSIZEF& desi
         // Finally, measure Group4.
         IFC_RETURN(MeasureCellsGroup(cellGroups.group4, childrenCount, rowSpacing, columnSpacing, FALSE, FALSE, cellCacheVector));
 
-        desiredSize.width = GetDesiredInnerSize(m_pColumns) + combinedColumnSpacing;
-        desiredSize.height = GetDesiredInnerSize(m_pRows) + combinedRowSpacing;
+        desiredSize.width = GetDesiredInnerSize(m_pColumns) + combinedColumnSpacing + combinedThickness.width;
+        desiredSize.height = GetDesiredInnerSize(m_pRows) + combinedRowSpacing + combinedThickness.height;
+
+        // Cells of Group2 are measured twice when there is a cyclic dependency, in which case the
+        // constraint of their last measure does not account for the width they contributed.
+        const bool measuredGroup2Twice = HasGridFlags(GridFlags::HasAutoRowsAndStarColumn) && cellGroups.group2 < childrenCount;
+
+        if (!measuredGroup2Twice)
+        {
+            UpdateMeasureCache(availableSize, combinedThickness, desiredSize, cellCacheVector);
+        }
+
+        return S_OK;
     }
 
     desiredSize.width += combinedThickness.width;
@@ -1259,9 +1406,6 @@ _Check_return_ HRESULT CGrid::ArrangeOverride(XSIZEF finalSize, XSIZEF& newFinal
     LockDefinitions();
     auto scopeGuard = wil::scope_exit([&]
     {
-        delete[] m_ppTempDefinitions;
-        m_ppTempDefinitions = nullptr;
-        m_cTempDefinitions = 0;
         UnlockDefinitions();
     });
 
@@ -128,6 +128,8 @@ CResourceDictionary::SetValue(_In_ const SetValueParams& args)
             }
         case KnownPropertyIndex::ResourceDictionary_MergedDictionaries:
             {
+                InvalidateMergedResourceIndex();
+
                 if (m_pMergedDictionaries)
                 {
                     m_pMergedDictionaries->SetResourceOwner(m_pResourceOwner);
@@ -449,8 +451,16 @@ CResourceDictionary::GetKeyNoRefImpl(
         }
     }
 
+    if (!value && useKeysNotFoundCache && m_mergedResourceIndex)
+    {
+        // We found this key in a merged dictionary before, and it is still there.
+        value = FindInMergedResourceIndex(modifiedKey, dictionaryReadFrom);
+    }
+
     if (!value && Resources::DoesScopeMatch(scope, Resources::LookupScope::Merged) && m_pMergedDictionaries)
     {
+        xref_ptr<CResourceDictionary> mergedDictionaryReadFrom;
+
         // NOTE: This looks like a buggy implementation of precedence rules as global resources would take immediate
         // precedence when looked up through MergedDictionary skipping a lookup in ThemeDictionaries associated with this
         // resource dictionary.
@@ -468,9 +478,22 @@ CResourceDictionary::GetKeyNoRefImpl(
 
             xref_ptr<CResourceDictionary> currentDictionary;
             currentDictionary.attach(static_cast<CResourceDictionary*>(m_pMergedDictionaries->GetItemWithAddRef(i)));
-            IFC_RETURN(currentDictionary->GetKeyNoRefImpl(modifiedKey, scope, &value, dictionaryReadFrom));
+            IFC_RETURN(currentDictionary->GetKeyNoRefImpl(modifiedKey, scope, &value, &mergedDictionaryReadFrom));
             scope &= ~Resources::LookupScope::GlobalTheme;
         }
+
+        if (value)
+        {
+            if (useKeysNotFoundCache)
+            {
+                AddToMergedResourceIndex(key, mergedDictionaryReadFrom.get(), value);
+            }
+
+            if (dictionaryReadFrom)
+            {
+                *dictionaryReadFrom = std::move(mergedDictionaryReadFrom);
+            }
+        }
     }
 
     if (!value && Resources::DoesScopeMatch(scope, Resources::LookupScope::LocalTheme))
@@ -2247,6 +2270,8 @@ void CResourceDictionary::InvalidateNotFoundCache(bool propagate)
                 current->m_keysNotFoundCache->Clear();
             }
 
+            current->m_mergedResourceIndex.reset();
+
             current = GetParentDictionaryHelper(current);
         }
     }
@@ -2256,11 +2281,21 @@ void CResourceDictionary::InvalidateNotFoundCache(bool propagate)
         {
             m_keysNotFoundCache->Clear();
         }
+
+        m_mergedResourceIndex.reset();
     }
 }
 
 void CResourceDictionary::InvalidateNotFoundCache(bool propagate, const ResourceKey& key)
 {
+    const auto removeFromMergedResourceIndex = [&key](CResourceDictionary* dictionary)
+    {
+        if (dictionary->m_mergedResourceIndex)
+        {
+            dictionary->m_mergedResourceIndex->erase(key.ToStorage());
+        }
+    };
+
     if (propagate)
     {
         // Traverse dictionary sub-tree iteratively as it has less overhead.
@@ -2274,6 +2309,8 @@ void CResourceDictionary::InvalidateNotFoundCache(bool propagate, const Resource
                 current->m_keysNotFoundCache->Remove(key);
             }
 
+            removeFromMergedResourceIndex(current);
+
             current = GetParentDictionaryHelper(current);
         }
     }
@@ -2283,9 +2320,91 @@ void CResourceDictionary::InvalidateNotFoundCache(bool propagate, const Resource
         {
             m_keysNotFoundCache->Remove(key);
         }
+
+        removeFromMergedResourceIndex(this);
+    }
+}
+
+void CResourceDictionary::InvalidateMergedResourceIndex()
+{
+    CResourceDictionary* current = this;
+
+    while (current)
+    {
+        current->m_mergedResourceIndex.reset();
+        current = GetParentDictionaryHelper(current);
     }
 }
 
+CDependencyObject* CResourceDictionary::FindInMergedResourceIndex(
+    const ResourceKey& key,
+    _Out_opt_ xref_ptr<CResourceDictionary>* dictionaryReadFrom) const
+{
+    const auto bucketIndex = std::hash<ResourceKey>()(key) % m_mergedResourceIndex->bucket_count();
+
+    auto pos = std::find_if(
+        m_mergedResourceIndex->begin(bucketIndex),
+        m_mergedResourceIndex->end(bucketIndex),
+        [&key](const auto& entry)
+        {
+            return key == entry.first;
+        });
+
+    if (pos == m_mergedResourceIndex->end(bucketIndex))
+    {
+        return nullptr;
+    }
+
+    const MergedResourceIndexEntry& entry = pos->second;
+
+    // Removing a key from a merged dictionary doesn't invalidate the index, so check that the value is still
+    // in the dictionary we found it in. Otherwise, fall back to searching the merged dictionaries again.
+    if (entry.m_dictionaryReadFrom->FindResourceByKey(key) != entry.m_value)
+    {
+        return nullptr;
+    }
+
+    if (dictionaryReadFrom)
+    {
+        *dictionaryReadFrom = entry.m_dictionaryReadFrom;
+    }
+
+    return entry.m_value;
+}
+
+void CResourceDictionary::AddToMergedResourceIndex(
+    const ResourceKey& key,
+    _In_ CResourceDictionary* dictionaryReadFrom,
+    _In_ CDependencyObject* value)
+{
+    // Only index values that were found in a merged dictionary's own keys. Values found in theme dictionaries
+    // depend on the theme in effect for the lookup, and values that are still deferred aren't in the dictionary
+    // we can check them against.
+    if (!dictionaryReadFrom || dictionaryReadFrom->FindResourceByKey(key) != value)
+    {
+        return;
+    }
+
+    CResourceDictionary* current = dictionaryReadFrom;
+
+    while (current != this)
+    {
+        if (!current || current->IsThemeDictionary() || current->IsThemeDictionaries())
+        {
+            return;
+        }
+
+        current = GetParentDictionaryHelper(current);
+    }
+
+    if (!m_mergedResourceIndex)
+    {
+        m_mergedResourceIndex = std::make_unique<std::unordered_map<ResourceKeyStorage, MergedResourceIndexEntry>>();
+    }
+
+    (*m_mergedResourceIndex)[key.ToStorage()] = MergedResourceIndexEntry { xref_ptr<CResourceDictionary>(dictionaryReadFrom), value };
+}
+
 KnownTypeIndex CColorPaletteResources::GetTypeIndex() const
 {
     return DependencyObjectTraits<CColorPaletteResources>::Index;
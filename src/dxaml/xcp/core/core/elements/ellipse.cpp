@@ -124,6 +124,7 @@ CEllipse::UpdateRenderGeometry()
     pGeometryNoRef->m_eRadiusY = (rectBounds.Height) * 0.5f;
     pGeometryNoRef->m_ptCenter.x = rectBounds.X + (pGeometryNoRef->m_eRadiusX);
     pGeometryNoRef->m_ptCenter.y = rectBounds.Y + (pGeometryNoRef->m_eRadiusY);
+    pGeometryNoRef->InvalidateHitTestCache();
 
     InvalidateGeometryBounds();
 
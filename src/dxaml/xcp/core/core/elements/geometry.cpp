@@ -7,6 +7,7 @@
 #include "VisualContentRenderer.h"
 #include "d3d11device.h"
 #include "WindowsGraphicsDeviceManager.h"
+#include "PathGeometryMarkup.h"
 
 //------------------------------------------------------------------------
 //
@@ -1613,6 +1614,11 @@ CPathGeometry::Create(
     if (pCreate->m_value.GetType() == valueString)
     {
         CGeometryBuilder *pBuilder;
+        std::shared_ptr<const PathGeometryMarkup> spMarkup;
+
+        // Parse the string, or reuse the commands already parsed for the same markup.
+        IFC(pCreate->m_pCore->GetPathGeometryMarkupCache().GetMarkup(pCreate->m_value.AsString(), &spMarkup));
+
         pCreate->m_pCore->ResetGeometryBuilder(0);
 
         //
@@ -1625,10 +1631,7 @@ CPathGeometry::Create(
             &pBuilder,
             TRUE));
 
-        // If we're given a string then parse it now.
-        XUINT32 cString = 0;
-        const WCHAR* pString = pCreate->m_value.AsEncodedString().GetBufferAndCount(&cString);
-        IFC(_this->ParseGeometry(pBuilder, cString, pString, TRUE));
+        IFC(spMarkup->Replay(pBuilder, &_this->m_fillMode));
 
         IFC(pBuilder->ClosePathGeometryBuilder(_this));
     }
@@ -1643,328 +1646,6 @@ Cleanup:
     RRETURN(hr);
 }
 
-//------------------------------------------------------------------------
-//
-//  Synopsis:
-//      Parses the geometry mini-language.  Could be used to build either or
-//      both the Path.Data and Path.Clip attributes.
-//
-//------------------------------------------------------------------------
-
-#define MAX_NUMERICS    8
-
-_Check_return_ HRESULT
-CPathGeometry::ParseGeometry(
-    _In_ CGeometryBuilder *pBuilder,
-    _In_ XUINT32 cData,
-    _In_reads_(cData) const WCHAR *pRasterizerPath,
-    _In_ XINT32 bAllowFill
-    )
-{
-    XINT32      bComma = FALSE;         // Is a comma allowed at this time
-    WCHAR       cmd = L'\0';            // Current command marker
-    XUINT32     cUnsigned = 0;          // For arcs the first two values can't be signed
-    XUINT32     cNumeric = 0;           // Remaining numeric values to parse in this command
-    XUINT32     iNumeric = 0;           // Index of current numeric value
-    XFLOAT      aNumeric[MAX_NUMERICS]; // Buffer for numeric values in a command
-    XPOINTF     aptArc[3];              // Buffer for shuffling arc values
-    XINT32      mBoolean = 0;           // Mask for field type
-    XINT32      flags;
-
-// While there are characters left keep parsing
-
-    while (cData)
-    {
-    // Consume white space and optional comma
-
-        while (cData && xisspace(*pRasterizerPath))
-        {
-            pRasterizerPath++;
-            cData--;
-        }
-
-    // We might be allowed to have a comma
-
-        if (bComma && cData && (L',' == *pRasterizerPath))
-        {
-            bComma = FALSE;
-            cData--;
-            pRasterizerPath++;
-
-        // After the comma there can be more white space
-
-            while (cData && xisspace(*pRasterizerPath))
-            {
-                pRasterizerPath++;
-                cData--;
-            }
-        }
-
-    // We've found a token. If cNumeric is non-zero it must be a numeric value.
-
-        if (cNumeric)
-        {
-        // Ensure future code changes don't cause a buffer overrun in aNumeric
-
-            if (iNumeric >= MAX_NUMERICS)
-            {
-                IFC_RETURN(E_UNEXPECTED);
-            }
-
-        // Read the boolean or floating point value from the data
-#if DBG
-            const WCHAR* pPrevious = pRasterizerPath;
-#endif
-            const XUINT32 cPrevious = cData;
-
-            if (mBoolean & 1)
-            {
-                if (cData && ((L'0' == *pRasterizerPath) || (L'1' == *pRasterizerPath)))
-                {
-                    *((XINT32 *) &aNumeric[iNumeric++]) = XINT32(*pRasterizerPath - L'0');
-
-                // Update pRasterizerPath so it appears we read some data.  Note that if
-                // pRasterizerPath isn't adjusted then the code below will interpret it
-                // as a parse failure and exit with an error.
-
-                    pRasterizerPath = pRasterizerPath + 1;
-                    cData = cData - 1;
-                }
-            }
-            else
-            {
-                if (cUnsigned)
-                {
-                    cUnsigned--;
-                    IFC_RETURN(NonSignedFromString(cData, pRasterizerPath, &cData, &pRasterizerPath, &aNumeric[iNumeric++]));
-                }
-                else
-                {
-                    IFC_RETURN(FloatFromString(cData, pRasterizerPath, &cData, &pRasterizerPath, &aNumeric[iNumeric++]));
-                }
-            }
-
-            ASSERT(cData <= cPrevious);
-            ASSERT(pPrevious <= pRasterizerPath && (pPrevious + cPrevious) <= (pRasterizerPath + cData));
-
-        // If we failed to parse a value then an error has occurred.
-
-            if (cData == cPrevious)
-            {
-                IFC_RETURN(E_UNEXPECTED);
-            }
-
-        // Shift the boolean mask and adjust the remaining count of numerics
-
-            mBoolean >>= 1;
-            if (--cNumeric)
-            {
-            // If there are more numeric values then allow a comma
-
-                bComma = TRUE;
-            }
-            else
-            {
-            // At the end of a command there can be no more commas
-
-                bComma = FALSE;
-
-            // We parsed all the values necessary for the current command.  See
-            // if it contained relative offsets or absolute positions
-
-                flags = xislower(cmd) ? XcpPointType_Relative : XcpPointType_Absolute;
-
-            // Now we can submit the object to the geometry builder
-
-                switch (cmd & 0x00df)
-                {
-            // Add an arc to the geometry.  We're going to have to shuffle the
-            // values around to get this to work.  Note that we can't copy the
-            // whole point from the sixth and seventh fields at once since this
-            // could cause an unaligned address exception on some architectures
-            // since the 64 bit field isn't aligned properly.
-
-                case 'A':
-                    aptArc[0].x = aNumeric[5];
-                    aptArc[0].y = aNumeric[6];
-                    aptArc[1] = *((XPOINTF *) &aNumeric[0]);
-                    IFC_RETURN(pBuilder->AddArc(flags, aptArc, aNumeric[2], *((XINT32 *) &aNumeric[3]), *((XINT32 *) &aNumeric[4])));
-                    break;
-
-            // Add a cubic Bezier curve to the geometry
-
-                case 'S':
-                    IFC_RETURN(pBuilder->ComputeReflection(flags, PathPointTypeBezier, (XPOINTF *) &aNumeric[0]));
-
-                case 'C':
-                    IFC_RETURN(pBuilder->AddBezier(flags, (XPOINTF *) &aNumeric[0]));
-                    break;
-
-            // Set the fill mode of the geometry
-
-                case 'F':
-                    m_fillMode = *((XINT32 *) &aNumeric[0]) ? XcpFillModeWinding : XcpFillModeAlternate;
-                    break;
-
-            // Add a line segment to the geometry
-
-                case 'H':
-                    IFC_RETURN(pBuilder->AddLine(flags | VALID_X, (XPOINTF *) &aNumeric[0]));
-                    break;
-
-                case 'L':
-                    IFC_RETURN(pBuilder->AddLine(flags | VALID_XY, (XPOINTF *) &aNumeric[0]));
-                    break;
-
-                case 'V':
-                    IFC_RETURN(pBuilder->AddLine(flags | VALID_Y, (XPOINTF *) &aNumeric[0]));
-                    break;
-
-            // Start a new figure in the geometry
-
-                case 'M':
-                    IFC_RETURN(pBuilder->OpenFigure(flags, (XPOINTF *) &aNumeric[0]));
-
-                // Any points after the 'M' are implicitly a lineto unless there is another command
-                // Use cmd-- to convert an 'M' to 'L' and an 'm' to 'l'
-
-                    cmd--;
-                    break;
-
-            // Add a quadratic Bezier curve to the geometry
-
-                case 'T':
-                    IFC_RETURN(pBuilder->ComputeReflection(flags, PathPointTypeQuadratic, (XPOINTF *) &aNumeric[0]));
-
-                case 'Q':
-                    IFC_RETURN(pBuilder->AddQuadratic(flags, (XPOINTF *) &aNumeric[0]));
-                    break;
-                }
-            }
-        }
-        else if (cData)
-        {
-        // If the next token is a numeric value and we have a previous command
-        // then we can repeat the previous command.
-
-            if (xisfleading(*pRasterizerPath))
-            {
-                if (!cmd)
-                {
-                    IFC_RETURN(E_UNEXPECTED);
-                }
-            }
-            else if (L',' == *pRasterizerPath)
-            {
-            // Special check for interior commas.  On the surface this seems to
-            // violate the SVG specification but it does not.  For example take
-            // the 'Q' command. In our implementation this has 4 parameters but
-            // in the SVG specification it has a multiple of 4 parameters.  So
-            // we check for the comma here as a repeat of the previous command
-            // and consume it before continuing.
-
-                if (!cmd)
-                {
-                    IFC_RETURN(E_UNEXPECTED);
-                }
-
-                pRasterizerPath++;
-                cData--;
-            }
-            else
-            {
-            // Get the new command marker
-
-                cmd = *pRasterizerPath;
-                pRasterizerPath++;
-                cData--;
-            }
-
-        // Reset the index and assume all values are signed floats
-
-            iNumeric = 0;
-            mBoolean = 0;
-            cUnsigned = 0;
-
-        // Process the new command
-
-            switch (cmd & 0x00df)
-            {
-            case 'A':   // Adds an arc.
-                cNumeric = 7;
-                cUnsigned = 2;      // The radii must not be signed
-                mBoolean = 0x0018;  // The flags are booleans
-                break;
-
-            case 'C':   // Adds 3 control points to define a cubic Bezier
-                cNumeric = 6;
-                break;
-
-            case 'F':   // Sets the fill mode (0 = Alternate, 1 = Winding)
-                if (!bAllowFill)
-                {
-                    IFC_RETURN(E_UNEXPECTED);
-                }
-
-                cNumeric = 1;
-                mBoolean = 0x0001;
-                break;
-
-            case 'H':   // Horizontal line to
-                cNumeric = 1;
-                break;
-
-            case 'L':   // Arbitrary line to
-                cNumeric = 2;
-                break;
-
-            case 'M':   // Move to (starts a figure)
-                cNumeric = 2;
-                break;
-
-            case 'Q':   // Adds 2 control points to define a quadratic curve
-                cNumeric = 4;
-                break;
-
-            case 'S':   // Adds 2 control points to continue a cubic Bezier
-                iNumeric = 2;
-                cNumeric = 4;
-                break;
-
-            case 'T':   // Adds 1 control point to continue a quadratic curve
-                iNumeric = 2;
-                cNumeric = 2;
-                break;
-
-            case 'V':   // Vertical line to (Y value is passed in X)
-                cNumeric = 1;
-                break;
-
-            case 'Z':   // Close a figure
-                IFC_RETURN(pBuilder->CloseFigure());
-                cmd = 0;
-                break;
-
-            default:
-                IFC_RETURN(E_UNEXPECTED);
-            }
-        }
-
-    // After the first token we can no longer allow F{0|1} to be parsed.
-
-        bAllowFill = FALSE;
-    }
-
-// If we got here with parameters remaining to be read it is an error
-
-    if (cNumeric)
-    {
-        IFC_RETURN(E_UNEXPECTED);
-    }
-
-    return S_OK;
-}
-
 //------------------------------------------------------------------------
 //
 //  CPathGeometry::GetPrintGeometryVirtual
@@ -2721,32 +2402,34 @@ CGeometry::HitTestFill(
     _Out_ bool* pHit
     )
 {
-    HRESULT hr = S_OK;
-    bool hit = true;
-    PointHitTestGeometrySink* pSink = NULL;
+    //
+    // Pointer input hit tests the same geometry with the same transform over and
+    // over, so flatten the fill once and query the indexed edges after that.
+    //
+    if (!m_flattenedFillEdges || !m_flattenedFillEdges->IsValidFor(pTransform, 0.25f))
+    {
+        m_flattenedFillEdges.reset();
 
-    pSink = new PointHitTestGeometrySink(target, 0.25f, pTransform);
+        IFC_RETURN(FlattenedGeometryEdges::Create(this, pTransform, 0.25f, &m_flattenedFillEdges));
+    }
 
-    IFC(VisitSink(pSink));
+    *pHit = m_flattenedFillEdges->HitTest(target);
 
-    IFC(pSink->Close());
-
-    if (FAILED(pSink->GetResult(&hit)))
+#if DBG
+    // A stale cache means some in-place geometry update skipped InvalidateHitTestCache.
     {
-        //
-        // Some geometry may not be valid such as have degenerate transforms or infinite
-        // points. In the case they are encountered the geometry is considered not hit.
-        //
-
-        hit = FALSE;
+        std::unique_ptr<FlattenedGeometryEdges> freshEdges;
+        IFC_RETURN(FlattenedGeometryEdges::Create(this, pTransform, 0.25f, &freshEdges));
+        ASSERT(freshEdges->HitTest(target) == *pHit);
     }
+#endif
 
-    *pHit = hit;
-
-Cleanup:
-    ReleaseInterface(pSink);
+    return S_OK;
+}
 
-    RRETURN(hr);
+void CGeometry::InvalidateHitTestCache()
+{
+    m_flattenedFillEdges.reset();
 }
 
 //------------------------------------------------------------------------
@@ -2983,6 +2666,15 @@ _Check_return_ HRESULT CGeometry::LeaveImpl(
     return S_OK;
 }
 
+void CGeometry::NWPropagateDirtyFlag(DirtyFlags flags)
+{
+    // Any change to the geometry, its figures or its transform invalidates
+    // the flattened edges used for hit testing.
+    InvalidateHitTestCache();
+
+    __super::NWPropagateDirtyFlag(flags);
+}
+
 void CGeometry::ReleaseDCompResources()
 {
     __super::ReleaseDCompResources();
@@ -88,6 +88,7 @@ CLine::UpdateRenderGeometry()
     pGeometryNoRef->m_ptStart.y = m_eY1;
     pGeometryNoRef->m_ptEnd.x = m_eX2;
     pGeometryNoRef->m_ptEnd.y = m_eY2;
+    pGeometryNoRef->InvalidateHitTestCache();
 
     InvalidateGeometryBounds();
 
@@ -18,6 +18,7 @@ CPanel::CPanel(_In_ CCoreServices *pCore)
     , m_pBackground(nullptr)
     , m_fNWBackgroundDirty(FALSE)
     , m_fNWBorderBrushDirty(FALSE)
+    , m_fChildrenBoundsTested(FALSE)
 {
     m_eWidth = static_cast<XFLOAT>(XDOUBLE_NAN);
     m_eHeight = static_cast<XFLOAT>(XDOUBLE_NAN);
@@ -357,6 +358,148 @@ CPanel::HitTestLocalInternal(
     RRETURN(CBorder::HitTestLocalInternalImpl(this, target, pHit));
 }
 
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Discards the grid over the children's outer bounds. Called whenever
+//      the child bounds are regenerated.
+//
+//------------------------------------------------------------------------
+void CPanel::InvalidateChildBoundsGrid()
+{
+    m_childBoundsGrid.reset();
+    m_fChildrenBoundsTested = FALSE;
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Walk the children of the panel finding elements that intersect
+//      with the given point.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+CPanel::BoundsTestChildren(
+    _In_ const XPOINTF& target,
+    _In_ CBoundedHitTestVisitor* pCallback,
+    _In_opt_ const HitTestParams *hitTestParams,
+    _In_ bool canHitDisabledElements,
+    _In_ bool canHitInvisibleElements,
+    _Out_opt_ BoundsWalkHitResult* pResult
+    )
+{
+    RRETURN(BoundsTestChildrenWithGrid(target, pCallback, hitTestParams, canHitDisabledElements, canHitInvisibleElements, pResult));
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Walk the children of the panel finding elements that intersect
+//      with the given polygon.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+CPanel::BoundsTestChildren(
+    _In_ const HitTestPolygon& target,
+    _In_ CBoundedHitTestVisitor* pCallback,
+    _In_opt_ const HitTestParams *hitTestParams,
+    _In_ bool canHitDisabledElements,
+    _In_ bool canHitInvisibleElements,
+    _Out_opt_ BoundsWalkHitResult* pResult
+    )
+{
+    RRETURN(BoundsTestChildrenWithGrid(target, pCallback, hitTestParams, canHitDisabledElements, canHitInvisibleElements, pResult));
+}
+
+//------------------------------------------------------------------------
+//
+//  Synopsis:
+//      Walk only the children whose outer bounds may intersect the target,
+//      as found by the child bounds grid, in reverse render order. This
+//      skips exactly the children CUIElement::BoundsTestInternal would
+//      reject with its outer bounds check, so it falls back to walking
+//      every child whenever that check is bypassed.
+//
+//------------------------------------------------------------------------
+template <typename HitType>
+_Check_return_ HRESULT
+CPanel::BoundsTestChildrenWithGrid(
+    _In_ const HitType& target,
+    _In_ CBoundedHitTestVisitor* pCallback,
+    _In_opt_ const HitTestParams *hitTestParams,
+    _In_ bool canHitDisabledElements,
+    _In_ bool canHitInvisibleElements,
+    _Out_opt_ BoundsWalkHitResult* pResult
+    )
+{
+    XUINT32 childCount = 0;
+    CUIElement** ppUIElements = nullptr;
+    std::vector<XUINT32> candidates;
+    bool useGrid = false;
+
+    GetChildrenInRenderOrder(&ppUIElements, &childCount);
+
+    if (childCount >= ChildBoundsGrid::s_minChildCount
+        && !GetContext()->InvisibleHitTestMode()
+        && !canHitInvisibleElements
+        && !(hitTestParams != nullptr && hitTestParams->hasTransform3DInSubtree)
+        && !HasDepthLegacy()
+        && !Has3DDepthOnSelfOrSubtree())
+    {
+        if (m_childBoundsGrid != nullptr)
+        {
+            useGrid = m_childBoundsGrid->GetCandidates(target, ppUIElements, childCount, &candidates);
+        }
+
+        if (!useGrid && m_fChildrenBoundsTested)
+        {
+            // Either this is the second test since the child bounds changed, or the children
+            // were reordered since the grid was built.
+            m_childBoundsGrid.reset(new ChildBoundsGrid());
+            IFC_RETURN(m_childBoundsGrid->Build(ppUIElements, childCount));
+
+            useGrid = m_childBoundsGrid->GetCandidates(target, ppUIElements, childCount, &candidates);
+            ASSERT(useGrid);
+        }
+
+        m_fChildrenBoundsTested = TRUE;
+    }
+
+    if (!useGrid)
+    {
+        RRETURN(CFrameworkElement::BoundsTestChildren(target, pCallback, hitTestParams, canHitDisabledElements, canHitInvisibleElements, pResult));
+    }
+
+    BoundsWalkHitResult hitResult = BoundsWalkHitResult::Continue;
+    BoundsWalkHitResult childHitResult = BoundsWalkHitResult::Continue;
+
+    // Candidates are in reverse render order (front to back).
+    for (XUINT32 i = 0; i < candidates.size() && flags_enum::is_set(childHitResult, BoundsWalkHitResult::Continue); ++i)
+    {
+        IFC_RETURN(ppUIElements[candidates[i]]->BoundsTestInternal(target, pCallback, hitTestParams, canHitDisabledElements, canHitInvisibleElements, &childHitResult));
+
+        // If any child wanted to include its parent chain, copy the flag.
+        if (flags_enum::is_set(childHitResult, BoundsWalkHitResult::IncludeParents))
+        {
+            hitResult = flags_enum::set(hitResult, BoundsWalkHitResult::IncludeParents);
+        }
+    }
+
+    // If the child element wanted the bounds walk to stop, remove the continue flag
+    // from the result.
+    if (!flags_enum::is_set(childHitResult, BoundsWalkHitResult::Continue))
+    {
+        hitResult = flags_enum::unset(hitResult, BoundsWalkHitResult::Continue);
+    }
+
+    if (pResult)
+    {
+        *pResult = hitResult;
+    }
+
+    return S_OK;
+}
+
 _Check_return_
 HRESULT
 CPanel::PanelGetClosestIndexSlow(
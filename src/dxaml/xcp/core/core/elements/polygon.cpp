@@ -82,6 +82,7 @@ CPolygon::UpdateRenderGeometry()
             points.data(),
             points.size(),
             TRUE /* fIsClosed */));
+        pGeometryNoRef->InvalidateHitTestCache();
     }
 
     InvalidateGeometryBounds();
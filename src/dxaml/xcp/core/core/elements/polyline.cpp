@@ -82,6 +82,7 @@ CPolyline::UpdateRenderGeometry()
             points.data(),
             points.size(),
             FALSE /* fIsClosed */));
+        pGeometryNoRef->InvalidateHitTestCache();
     }
 
     InvalidateGeometryBounds();
@@ -233,6 +233,7 @@ CRectangle::UpdateRenderGeometry()
     pGeometryNoRef->m_eRadiusX = m_eRadiusX;
     pGeometryNoRef->m_eRadiusY = m_eRadiusY;
     pGeometryNoRef->m_rc = GetOutlineRect(TRUE /*checkDegenerateStroke*/);
+    pGeometryNoRef->InvalidateHitTestCache();
 
     InvalidateGeometryBounds();
 
@@ -2803,7 +2803,7 @@ CUIElement::OnZOrderChanged()
     CUIElement *pParent = GetUIElementParentInternal();
     if (pParent)
     {
-        pParent->SetChildRenderOrderDirty();
+        pParent->SetChildRenderOrderDirty(this);
     }
 
     // The primitive composition walk uses a persistent data structure for its render data.
@@ -3160,6 +3160,50 @@ CUIElement::TransformToVisual(
     return S_OK;
 }
 
+//------------------------------------------------------------------------
+//
+//  Method:   TryGetTranslationToVisual
+//
+//  Synopsis: Returns the translation from the current UIElement to the
+//  given UIElement (or the root visual when null) when TransformToVisual
+//  would return a pure 2D translation.  Avoids the allocation of the
+//  CMatrixTransform and CMatrix objects for callers that only need the
+//  offset.
+//
+//------------------------------------------------------------------------
+_Check_return_ HRESULT
+CUIElement::TryGetTranslationToVisual(
+    _In_opt_ CUIElement* pVisual,
+    _Out_ bool* isTranslation,
+    _Out_ XPOINTF* translation)
+{
+    bool isReverse = false;
+    xref_ptr<ITransformer> transformer;
+
+    *isTranslation = false;
+    *translation = {};
+
+    IFC_RETURN(TransformToVisualHelperGetTransformer(pVisual, &isReverse, transformer.ReleaseAndGetAddressOf()));
+
+    if (!transformer)
+    {
+        *isTranslation = true;
+    }
+    else if (transformer->IsPure2D())
+    {
+        const CMILMatrix matTransform = transformer->Get2DMatrixIgnore3D();
+
+        if (matTransform.IsTranslationOnly())
+        {
+            *isTranslation = true;
+            translation->x = isReverse ? -matTransform.GetDx() : matTransform.GetDx();
+            translation->y = isReverse ? -matTransform.GetDy() : matTransform.GetDy();
+        }
+    }
+
+    return S_OK;
+}
+
 //------------------------------------------------------------------------
 //
 //  Method:   AggregateElementTransform
@@ -3420,7 +3464,6 @@ Cleanup:
 //
 //  Synopsis:
 //      Notification that children collection has changed.
-//      This method checks for z-order changes and invalidates sorting as needed.
 //
 //------------------------------------------------------------------------
 void
@@ -3464,22 +3507,8 @@ CUIElementCollection::OnChildrenChanged(_In_opt_ CDependencyObject *pChildSender
         }
     }
 
-    //
-    // Two cases when we need to mark the collection as dirty for checking and re-sorting:
-    //   1. The child with a ZIndex is added
-    //   2. The child collection is already sorted
-    //      - A new element needs to be sorted into the existing sorted collection.
-    //      - A removed element needs to be removed from the existing sorted collection.
-    //
-    // Note: The sort dirtiness is ignored if there are no children or there is one child.
-    // It won't cause checking/sorting and won't be cleared until we have added a second
-    // child.
-    //
-    if (   child && child->GetZIndex() != 0
-        || HasSortedChildren())
-    {
-        SetSortedCollectionDirty(TRUE);
-    }
+    // Note: The render order is updated separately by OnChildInsertedForRenderOrder/OnChildRemovedForRenderOrder,
+    // since those need the index of the child.
 }
 
 //------------------------------------------------------------------------
@@ -4592,10 +4621,31 @@ CUIElement::TransformToGlobalCoordinateSpaceThroughViewports(
     }
 
     // Finally, if we're treating this element as a viewport, we want to
-    // collect its transform to the previous viewport.
+    // collect its transform to the previous viewport. We also keep track of
+    // whether the chain up to global coordinates is a mere translation, which
+    // is the case while scrolling without zooming, so that listeners can skip
+    // the transform objects (see ComputeEffectiveViewportChangedEventArgsAndNotifyLayoutManager).
     if (treatAsViewport)
     {
-        transformsToViewports.emplace_back(this, transform);
+        bool isTranslationToGlobal = transformsToViewports.empty() || transformsToViewports.back().IsTranslationToGlobal();
+        XPOINTF translationToGlobal = transformsToViewports.empty() ? XPOINTF{} : transformsToViewports.back().GetTranslationToGlobal();
+        CMatrixTransform* matrixTransform = do_pointer_cast<CMatrixTransform>(transform.get());
+
+        if (isTranslationToGlobal && matrixTransform)
+        {
+            CMILMatrix matTransform(FALSE);
+            matrixTransform->GetTransform(&matTransform);
+
+            isTranslationToGlobal = matTransform.IsTranslationOnly();
+            translationToGlobal.x += matTransform.GetDx();
+            translationToGlobal.y += matTransform.GetDy();
+        }
+        else
+        {
+            isTranslationToGlobal = false;
+        }
+
+        transformsToViewports.emplace_back(this, transform, isTranslationToGlobal, translationToGlobal);
     }
 
     return S_OK;
@@ -4673,11 +4723,42 @@ CUIElement::ComputeEffectiveViewportChangedEventArgsAndNotifyLayoutManager(
     CLayoutManager* layoutManager = VisualTree::GetLayoutManagerForElement(this);
     ASSERT(layoutManager);
 
+    // When scrolling, listeners are usually only translated relative to the
+    // viewports. In that case, rects are moved between global coordinates and
+    // this element's coordinate space with a single offset instead of going
+    // through TransformToVisual and the inverse of every viewport transform,
+    // which would allocate several transform objects per listener and frame.
+    bool isTranslationToGlobal = false;
+    XPOINTF translationToGlobal = {};
+
+    if (transformsToViewports.empty() || transformsToViewports.back().IsTranslationToGlobal())
+    {
+        IFC_RETURN(TryGetTranslationToVisual(
+            transformsToViewports.empty() ? nullptr : transformsToViewports.back().GetElement(),
+            &isTranslationToGlobal,
+            &translationToGlobal));
+
+        if (isTranslationToGlobal && !transformsToViewports.empty())
+        {
+            translationToGlobal.x += transformsToViewports.back().GetTranslationToGlobal().x;
+            translationToGlobal.y += transformsToViewports.back().GetTranslationToGlobal().y;
+        }
+    }
+
     XRECTF rect = { 0.0f, 0.0f, 0.0f, 0.0f };
-    IFC_RETURN(TransformToGlobalCoordinateSpaceThroughViewports(
-        false /* treatAsViewport */,
-        transformsToViewports,
-        rect));
+
+    if (isTranslationToGlobal)
+    {
+        ASSERT(HasLayoutStorage());
+        rect = { translationToGlobal.x, translationToGlobal.y, RenderSize.width, RenderSize.height };
+    }
+    else
+    {
+        IFC_RETURN(TransformToGlobalCoordinateSpaceThroughViewports(
+            false /* treatAsViewport */,
+            transformsToViewports,
+            rect));
+    }
 
     XRECTF ev = { 0.0f, 0.0f, 0.0f, 0.0f };
     ComputeUnidimensionalEffectiveViewport(horizontalViewports, ev.X, ev.Width);
@@ -4687,7 +4768,15 @@ CUIElement::ComputeEffectiveViewportChangedEventArgsAndNotifyLayoutManager(
     {
         // If we have a valid effective viewport, we now need to transform
         // from global coordinates to the element coordinate space.
-        IFC_RETURN(TransformToElementCoordinateSpaceThroughViewports(transformsToViewports, ev));
+        if (isTranslationToGlobal)
+        {
+            ev.X -= translationToGlobal.x;
+            ev.Y -= translationToGlobal.y;
+        }
+        else
+        {
+            IFC_RETURN(TransformToElementCoordinateSpaceThroughViewports(transformsToViewports, ev));
+        }
     }
     else
     {
@@ -4705,7 +4794,15 @@ CUIElement::ComputeEffectiveViewportChangedEventArgsAndNotifyLayoutManager(
     {
         // If we have a valid max viewport, we now need to transform from
         // global coordinates to the element coordinate space.
-        IFC_RETURN(TransformToElementCoordinateSpaceThroughViewports(transformsToViewports, mv));
+        if (isTranslationToGlobal)
+        {
+            mv.X -= translationToGlobal.x;
+            mv.Y -= translationToGlobal.y;
+        }
+        else
+        {
+            IFC_RETURN(TransformToElementCoordinateSpaceThroughViewports(transformsToViewports, mv));
+        }
     }
     else
     {
@@ -8480,16 +8577,18 @@ CUIElement::NWComputeProjectionQuadPadding(
 //------------------------------------------------------------------------
 //
 //  Synopsis:
-//      Marks the child collection as dirty for sorting.
+//      Updates the render order of the child collection after the z-order
+//      of pChild changed. The collection repositions the child in place if
+//      it can, otherwise it's marked as dirty for sorting.
 //
 //------------------------------------------------------------------------
 void
-CUIElement::SetChildRenderOrderDirty()
+CUIElement::SetChildRenderOrderDirty(_In_ CUIElement* pChild)
 {
     CUIElementCollection *pChildren = GetChildren();
     if (pChildren)
     {
-        pChildren->SetSortedCollectionDirty(TRUE);
+        pChildren->OnChildZIndexChanged(pChild);
     }
 }
 
@@ -12803,6 +12902,12 @@ CUIElement::EnsureChildBounds(_In_opt_ HitTestParams *hitTestParams)
         //
         IFC_RETURN(GenerateChildOuterBounds(hitTestParams, &m_childBounds));
 
+        if (OfTypeByIndex<KnownTypeIndex::Panel>())
+        {
+            // The children's outer bounds may have changed, so the grid over them is stale.
+            static_cast<CPanel*>(this)->InvalidateChildBoundsGrid();
+        }
+
         CTransitionRoot* transitionRootNoRef = GetLocalTransitionRoot(false /*ensureTransitionRoot*/);
         if (transitionRootNoRef != NULL)
         {
@@ -0,0 +1,129 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#include "precomp.h"
+#include "FramePhaseProfiler.h"
+
+namespace
+{
+    std::uint32_t ToMicroseconds(Jupiter::HighResolutionClock::duration duration)
+    {
+        const auto microseconds = std::chrono::duration_cast<std::chrono::microseconds>(duration).count();
+        return static_cast<std::uint32_t>(std::min<long long>(std::max<long long>(microseconds, 0), UINT32_MAX));
+    }
+
+    // Returns the value at the given percentile, and partially reorders values to find it.
+    std::uint32_t GetPercentile(std::vector<std::uint32_t>& values, std::size_t percentile)
+    {
+        ASSERT(!values.empty());
+
+        const auto nth = values.begin() + (values.size() - 1) * percentile / 100;
+        std::nth_element(values.begin(), nth, values.end());
+        return *nth;
+    }
+}
+
+FramePhaseProfiler::PhaseScope::PhaseScope(_In_ FramePhaseProfiler* profiler, FramePhase phase)
+    : m_profiler(profiler)
+    , m_previousPhase(profiler->m_activePhase)
+{
+    m_profiler->SwitchPhase(phase);
+}
+
+FramePhaseProfiler::PhaseScope::~PhaseScope()
+{
+    m_profiler->SwitchPhase(m_previousPhase);
+}
+
+void FramePhaseProfiler::SwitchPhase(FramePhase phase)
+{
+    const auto now = Clock::now();
+
+    if (m_activePhase != FramePhase::Count)
+    {
+        m_phaseTimes[static_cast<std::size_t>(m_activePhase)] += now - m_phaseStart;
+    }
+
+    m_activePhase = phase;
+    m_phaseStart = now;
+}
+
+void FramePhaseProfiler::BeginFrame()
+{
+    m_frameStart = Clock::now();
+    m_isInFrame = true;
+}
+
+void FramePhaseProfiler::EndFrame(unsigned int frameNumber, std::uint32_t elementsRendered)
+{
+    if (!m_isInFrame)
+    {
+        return;
+    }
+
+    FramePhaseProfile profile = {};
+    profile.frameNumber = frameNumber;
+    profile.totalMicroseconds = ToMicroseconds(Clock::now() - m_frameStart);
+    profile.elementsMeasured = m_elementsMeasured;
+    profile.elementsArranged = m_elementsArranged;
+    profile.elementsRendered = elementsRendered;
+
+    for (std::size_t phase = 0; phase < c_framePhaseCount; ++phase)
+    {
+        profile.phaseMicroseconds[phase] = ToMicroseconds(m_phaseTimes[phase]);
+    }
+
+    m_frames.Log(profile);
+
+    m_phaseTimes.fill(Clock::duration::zero());
+    m_elementsMeasured = 0;
+    m_elementsArranged = 0;
+    m_isInFrame = false;
+}
+
+void FramePhaseProfiler::GetRecentFrames(std::uint16_t maxFrames, _Out_ std::vector<FramePhaseProfile>* frames) const
+{
+    const std::uint16_t frameCount = std::min(maxFrames, m_frames.Count());
+
+    frames->clear();
+    frames->reserve(frameCount);
+
+    for (std::uint16_t age = 0; age < frameCount; ++age)
+    {
+        frames->push_back(*m_frames.FromLast(age));
+    }
+}
+
+FramePhaseStatistics FramePhaseProfiler::GetStatistics(std::uint16_t maxFrames) const
+{
+    FramePhaseStatistics statistics = {};
+    statistics.frameCount = std::min(maxFrames, m_frames.Count());
+
+    if (statistics.frameCount == 0)
+    {
+        return statistics;
+    }
+
+    std::vector<std::uint32_t> values(statistics.frameCount);
+
+    for (std::uint16_t age = 0; age < statistics.frameCount; ++age)
+    {
+        values[age] = m_frames.FromLast(age)->totalMicroseconds;
+    }
+
+    statistics.totalP50Microseconds = GetPercentile(values, 50);
+    statistics.totalP99Microseconds = GetPercentile(values, 99);
+
+    for (std::size_t phase = 0; phase < c_framePhaseCount; ++phase)
+    {
+        for (std::uint16_t age = 0; age < statistics.frameCount; ++age)
+        {
+            values[age] = m_frames.FromLast(age)->phaseMicroseconds[phase];
+        }
+
+        statistics.phaseP50Microseconds[phase] = GetPercentile(values, 50);
+        statistics.phaseP99Microseconds[phase] = GetPercentile(values, 99);
+    }
+
+    return statistics;
+}
@@ -122,6 +122,12 @@ CEventManager::ClearRequests()
             CRequestsForObjectList* pRequests = (*mapItr).second;
             if(pRequests)
             {
+                // The requests hold a reference on the object, so it is still alive while the list is non-empty.
+                if (pRequests->size() > 0)
+                {
+                    (*mapItr).first->SetHasEventRequests(false);
+                }
+
                 XUINT32 uRequestCtr = 0;
                 while(uRequestCtr < pRequests->size())
                 {
@@ -130,6 +136,7 @@ CEventManager::ClearRequests()
                     REQUEST* pTemp = NULL;
                     IFC(pRequests->get_item(uRequestCtr, pTemp));
                     IFC(pRequests->set_item(uRequestCtr, NULL));
+                    OnRequestRemoved(pTemp);
                     delete pTemp;
                     ++uRequestCtr;
                 }
@@ -364,6 +371,7 @@ CEventManager::RemoveObject(_In_ CDependencyObject *pObject)
     if (m_pRequest && pObject)
     {
         IFC_RETURN(m_pRequest->Remove(pObject, pObjRequests));
+        pObject->SetHasEventRequests(false);
         if (pObjRequests)
         {
             // There shouldn't be any requests left because they should be removed by CUIElement::LeaveImpl
@@ -376,6 +384,7 @@ CEventManager::RemoveObject(_In_ CDependencyObject *pObject)
                 REQUEST* pTemp = NULL;
                 IFC_RETURN(pObjRequests->get_item(uRequestCtr, pTemp));
                 IFC_RETURN(pObjRequests->set_item(uRequestCtr, NULL));
+                OnRequestRemoved(pTemp);
                 delete pTemp;
                 ++uRequestCtr;
             }
@@ -438,6 +447,12 @@ CEventManager::AddRequest(
     }
     // Add the request to the list of event handlers for this object
     IFC(pObjRequests->push_back(request));
+    pObject->SetHasEventRequests(true);
+
+    if (static_cast<XUINT32>(request->m_hEvent.index) < KnownEventCount)
+    {
+        m_requestCounts[static_cast<XUINT32>(request->m_hEvent.index)]++;
+    }
 
     AddRefInterface(request->m_pListener);
     AddRefInterface(request->m_pObject);
@@ -556,6 +571,7 @@ CEventManager::ClearRequests(
                     // Remove the request from the list before deleting it. Deleting the request
                     // can release the contained DO, causing re-entrancy in the list and a double delete.
                     IFC_RETURN(pRequests->erase(uRequestCtr));
+                    OnRequestRemoved(pNodeRequest);
                     delete pNodeRequest;
                     pNodeRequest = NULL;
                 }
@@ -567,7 +583,10 @@ CEventManager::ClearRequests(
 
             // Do not delete the list even though it might be empty. This method call could be a re-entrant call
             // in the event manager i.e. there could be code on the stack iterating over this list.
-
+            if (pRequests->size() == 0)
+            {
+                pObject->SetHasEventRequests(false);
+            }
 
             // All Loaded event have been removed. Remove the object from the loaded event list.
             if(IsLoadedEvent(hEvent))
@@ -645,6 +664,7 @@ CEventManager::RemoveRequest(
                         // Remove the request from the list before deleting it. Deleting the request
                         // can release the contained DO, causing re-entrancy in the list and a double delete.
                         IFC_RETURN(pRegisteredRequests->erase(uRequestCtr));
+                        OnRequestRemoved(pNodeRequest);
                         delete pNodeRequest;
                         pNodeRequest = NULL;
                     }
@@ -665,7 +685,10 @@ CEventManager::RemoveRequest(
 
             // Do not delete the list even though it might be empty. This method call could be a re-entrant call
             // in the event manager i.e. there could be code on the stack iterating over this list.
-
+            if (pRegisteredRequests->size() == 0)
+            {
+                pObject->SetHasEventRequests(false);
+            }
 
             // If we removed a Loaded event handler and there are no more Loaded event handlers, then
             // remove the object from the Loaded event list.
@@ -679,6 +702,20 @@ CEventManager::RemoveRequest(
     return S_OK;
 }
 
+void CEventManager::OnRequestRemoved(_In_ const REQUEST* pRequest)
+{
+    if (pRequest && static_cast<XUINT32>(pRequest->m_hEvent.index) < KnownEventCount)
+    {
+        XUINT32& requestCount = m_requestCounts[static_cast<XUINT32>(pRequest->m_hEvent.index)];
+        ASSERT(requestCount > 0);
+
+        if (requestCount > 0)
+        {
+            requestCount--;
+        }
+    }
+}
+
 _Check_return_ HRESULT CEventManager::RaiseLoadedEventForObject(_In_ CDependencyObject* pLoadedEventObject, _In_ CEventArgs* loadedArgs)
 {
     TraceRaiseLoadedEventBegin((UINT64)pLoadedEventObject);
@@ -935,12 +972,17 @@ CEventManager::Raise(
         if(m_pRequest)
         {
             // If sender is known, get the list of event handlers for that sender. Else, raise the event for all objects.
+            // Routed events are raised on every ancestor of the source, and most ancestors have no handlers,
+            // so don't look up the sender's requests unless it has some and some object has one for this event.
             if(pSender)
             {
-                IFC(m_pRequest->Get(pSender, pRegisteredRequests));
-                if(pRegisteredRequests)
+                if (pSender->HasEventRequests() && HasRequests(hEvent))
                 {
-                    IFC(RaiseHelper(pRegisteredRequests, hEvent, pSender, pArgs, bRefire, pfnScriptCallback, bFired, pSenderOverride));
+                    IFC(m_pRequest->Get(pSender, pRegisteredRequests));
+                    if(pRegisteredRequests)
+                    {
+                        IFC(RaiseHelper(pRegisteredRequests, hEvent, pSender, pArgs, bRefire, pfnScriptCallback, bFired, pSenderOverride));
+                    }
                 }
             }
             else
@@ -1481,6 +1523,11 @@ bool CEventManager::IsRegisteredForEvent(_In_ CDependencyObject *pListener, _In_
 {
     CRequestsForObjectList* pRegisteredRequests = nullptr;
 
+    if (!pListener || !pListener->HasEventRequests() || !HasRequests(hEvent))
+    {
+        return false;
+    }
+
     if (SUCCEEDED(m_pRequest->Get(pListener, pRegisteredRequests)))
     {
         if (pRegisteredRequests)
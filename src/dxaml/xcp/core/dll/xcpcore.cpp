@@ -34,6 +34,7 @@
 #include <FrameworkTheming.h>
 #include <SystemThemingInterop.h>
 #include <ThemeWalkResourceCache.h>
+#include <PathGeometryMarkup.h>
 #include <GraphicsUtility.h>
 #include <DXamlServices.h>
 #include <AutoReentrantReferenceLock.h>
@@ -5106,6 +5107,24 @@ CCoreServices::GetResourceDictionaryUriCache()
     return m_resourceDictionaryUriCache;
 }
 
+//------------------------------------------------------------------------
+//
+// Method: GetPathGeometryMarkupCache
+//
+// Returns the path markup cache, creating it if necessary
+//
+//------------------------------------------------------------------------
+PathGeometryMarkupCache&
+CCoreServices::GetPathGeometryMarkupCache()
+{
+    if (!m_pathGeometryMarkupCache)
+    {
+        m_pathGeometryMarkupCache = std::make_unique<PathGeometryMarkupCache>();
+    }
+
+    return *m_pathGeometryMarkupCache;
+}
+
 //------------------------------------------------------------------------
 //
 //  Method:   GetGlyphPathBuilder
@@ -5988,6 +6007,7 @@ CCoreServices::NWDrawTree(
 
     bool checkForAnimationComplete = false;
     bool hasActiveFiniteAnimations = false;
+    XUINT32 elementsRendered = 0;
 
     const bool isRenderEnabled = IsRenderingFrames();
 
@@ -5997,6 +6017,7 @@ CCoreServices::NWDrawTree(
     // Trace the beginning of the frame
     //
     TraceFrameBegin();
+    m_framePhaseProfiler.BeginFrame();
 
     // tell framework about this time
     IFC(FxCallbacks::FrameworkCallbacks_BudgetService_StoreFrameTime(TRUE /* beginning of tick */));
@@ -6026,6 +6047,8 @@ CCoreServices::NWDrawTree(
     }
     else
     {
+        FramePhaseProfiler::PhaseScope tickPhase(&m_framePhaseProfiler, FramePhase::Tick);
+
         // Tick the timing manager, event manager, and deferred media event queue.
         IFC(Tick(TRUE /* tickForDrawing */, &checkForAnimationComplete, &hasActiveFiniteAnimations));
     }
@@ -6244,6 +6267,8 @@ CCoreServices::NWDrawTree(
         bool newAnimationsCheckForAnimationComplete = false;
         bool newAnimationsHasActiveFiniteAnimations = false;
 
+        FramePhaseProfiler::PhaseScope tickPhase(&m_framePhaseProfiler, FramePhase::Tick);
+
         // Note that layout can add more animations, so timelines are ticked in two separate places: once before layout
         // (to tick normal Storyboards) with newTimelinesOnly == false, and once after layout (to tick animations kicked
         // off by layout) with newTimelinesOnly == true. When we decide whether there are animations active, we need to
@@ -6360,13 +6385,19 @@ CCoreServices::NWDrawTree(
                 const bool hasUIAClientsListeningToStructure =
                     (UIAClientsAreListening(UIAXcp::AEStructureChanged) == S_OK);
 
-                hr = RenderWalk(
-                    pHWWalk,
-                    pRenderTarget,
-                    pVisualRoot,
-                    forceRedraw,
-                    hasUIAClientsListeningToStructure,
-                    &canSubmitFrame);
+                {
+                    FramePhaseProfiler::PhaseScope renderWalkPhase(&m_framePhaseProfiler, FramePhase::RenderWalk);
+
+                    hr = RenderWalk(
+                        pHWWalk,
+                        pRenderTarget,
+                        pVisualRoot,
+                        forceRedraw,
+                        hasUIAClientsListeningToStructure,
+                        &canSubmitFrame);
+                }
+
+                elementsRendered = static_cast<XUINT32>(pHWWalk->GetElementsRenderedCount());
 
                 // If there is a UIA client listening, fire the pending StructureChanged events.
                 // We do it right after the render walk has completed because some of these events
@@ -6446,11 +6477,15 @@ CCoreServices::NWDrawTree(
 
                 TraceSubmitFrameBegin();
 
-                IFC(SubmitPrimitiveCompositionCommands(
-                    pRenderTarget,
-                    pVisualRoot,
-                    m_pPALClock,
-                    rFrameStartTime));
+                {
+                    FramePhaseProfiler::PhaseScope submitFramePhase(&m_framePhaseProfiler, FramePhase::SubmitFrame);
+
+                    IFC(SubmitPrimitiveCompositionCommands(
+                        pRenderTarget,
+                        pVisualRoot,
+                        m_pPALClock,
+                        rFrameStartTime));
+                }
 
                 // Once we have submitted the composition commands, we can consider that a frame was drawn.
                 *pFrameDrawn = true;
@@ -6581,6 +6616,7 @@ Cleanup:
     //       of changing the data format.
     TraceFrameInfo(*pFrameDrawn);
     TraceFrameEnd();
+    m_framePhaseProfiler.EndFrame(m_uFrameNumber, elementsRendered);
 
     if (m_pendingFirstFrameTraceLoggingEvent)
     {
@@ -10039,6 +10075,11 @@ HRESULT CCoreServices::ShutdownToIdle()
 
     m_resourceDictionaryUriCache.Clear();
 
+    if (m_pathGeometryMarkupCache)
+    {
+        m_pathGeometryMarkupCache->Clear();
+    }
+
     IFC_RETURN(ClearMainRootImageCaches());
 
     m_appliedStyleTables.shrink_to_fit();
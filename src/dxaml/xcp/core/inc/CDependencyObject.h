@@ -1343,6 +1343,11 @@ public:
     bool GetCanParserOverwriteBaseUri() const { return m_canParserOverwriteBaseUri; }
     void SetCanParserOverwriteBaseUri(bool value) { m_canParserOverwriteBaseUri = value; }
 
+    // Whether the event manager holds any requests for this object. Set by CEventManager so raising a
+    // routed event on an ancestor without handlers can skip looking up its requests.
+    bool HasEventRequests() const { return m_hasEventRequests; }
+    void SetHasEventRequests(bool value) { m_hasEventRequests = value; }
+
     wrl::ComPtr<ixp::IIslandInputSitePartner> GetElementIslandInputSite();
 
     HWND GetElementPositioningWindow();
@@ -1522,6 +1527,10 @@ public:
     void SetIsParsing(XINT32 fIsParsing)  { m_bitFields.fIsParsing = fIsParsing; }
     bool IsParsing() const { return !!m_bitFields.fIsParsing; }
 
+    // Called by the parser when it has finished creating this object, to learn the typical sparse value table
+    // size of its type.
+    void RecordSparseValueTableSize() const;
+
     bool HasWeakRef() const { return m_ref_count.get_control_block() != nullptr; }
 
     void SetWantsInheritanceContextChanged(bool fWantsInheritanceContextChanged) { m_bitFields.fWantsInheritanceContextChanged = fWantsInheritanceContextChanged; }
@@ -1850,7 +1859,7 @@ protected:
 private:
     bool m_checkForResourceOverrides                        : 1;    // 11
     bool m_canParserOverwriteBaseUri                                 : 1;    // 12
-    bool                                                    : 1;    // 13- Unused
+    bool m_hasEventRequests                                 : 1;    // 13
     bool                                                    : 1;    // 14- Unused
     bool                                                    : 1;    // 15- Unused
     bool                                                    : 1;    // 16- Unused
@@ -0,0 +1,86 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+class CUIElement;
+class HitTestPolygon;
+
+//------------------------------------------------------------------------
+//
+//  Class:  ChildBoundsGrid
+//
+//  Synopsis:
+//      Uniform grid over the outer bounds of a panel's children, in the
+//  panel's local space.  A bounds walk only needs to visit the children
+//  whose outer bounds overlap the hit target, so a panel with many
+//  children looks those up in the grid instead of testing every child.
+//
+//      Children whose outer bounds can't be trusted for culling (popups,
+//  elements with 3D depth, elements hidden for a layout transition) and
+//  children that are too large for the grid are always returned as
+//  candidates.  The grid remembers the render order it was built with and
+//  reports when the panel's children no longer match it.
+//
+//------------------------------------------------------------------------
+
+class ChildBoundsGrid
+{
+public:
+    // Panels with fewer children than this are walked linearly.
+    static constexpr XUINT32 s_minChildCount = 64;
+
+    _Check_return_ HRESULT Build(
+        _In_reads_(childCount) CUIElement* const* ppChildren,
+        XUINT32 childCount
+        );
+
+    // Fills pCandidates with the render order positions of the children
+    // that may intersect the target, front to back.  Returns false if the
+    // children changed since the grid was built.
+    bool GetCandidates(
+        const XPOINTF& target,
+        _In_reads_(childCount) CUIElement* const* ppChildren,
+        XUINT32 childCount,
+        _Out_ std::vector<XUINT32>* pCandidates
+        ) const;
+
+    bool GetCandidates(
+        const HitTestPolygon& target,
+        _In_reads_(childCount) CUIElement* const* ppChildren,
+        XUINT32 childCount,
+        _Out_ std::vector<XUINT32>* pCandidates
+        ) const;
+
+private:
+    bool GetCandidatesInRect(
+        const XRECTF_RB& targetBounds,
+        _In_reads_(childCount) CUIElement* const* ppChildren,
+        XUINT32 childCount,
+        _Out_ std::vector<XUINT32>* pCandidates
+        ) const;
+
+    XUINT32 GetColumn(XFLOAT x) const;
+    XUINT32 GetRow(XFLOAT y) const;
+
+    // A child spanning more cells than this is always a candidate instead.
+    static constexpr XUINT32 s_maxCellsPerChild = 64;
+    static constexpr XUINT32 s_maxCellsPerSide = 256;
+
+    // The children in render order when the grid was built.
+    std::vector<CUIElement*> m_children;
+
+    // Positions of children that are candidates for every target.
+    std::vector<XUINT32> m_alwaysTested;
+
+    XRECTF_RB m_bounds = {};
+    XFLOAT m_cellWidth = 0.0f;
+    XFLOAT m_cellHeight = 0.0f;
+    XUINT32 m_columns = 0;
+    XUINT32 m_rows = 0;
+
+    // The children of cell i are m_cellChildren[m_cellStarts[i]] up to, but
+    // not including, m_cellChildren[m_cellStarts[i + 1]], in render order.
+    std::vector<XUINT32> m_cellStarts;
+    std::vector<XUINT32> m_cellChildren;
+};
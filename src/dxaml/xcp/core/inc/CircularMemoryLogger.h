@@ -23,6 +23,30 @@ public:
         // On the first call m_index + 1 will cause overflow and be equal to 0.
         m_index = (m_index + 1) % Size;
         m_log[m_index] = item;
+
+        if (m_count < Size)
+        {
+            ++m_count;
+        }
+    }
+
+    // Number of items currently held, at most Size.
+    std::uint16_t Count() const
+    {
+        return m_count;
+    }
+
+    // Returns the item logged age items before the last one, or nullptr if it has already been overwritten.
+    const T* FromLast(std::uint16_t age) const
+    {
+        if (age < m_count)
+        {
+            return &m_log[(m_index + Size - age) % Size];
+        }
+        else
+        {
+            return nullptr;
+        }
     }
 
     const T* Last() const
@@ -40,4 +64,5 @@ public:
 private:
     std::array<T, Size> m_log {};
     std::uint16_t m_index = c_emptySentinel;
+    std::uint16_t m_count = 0;
 };
@@ -0,0 +1,77 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "matrix.h"
+
+class CGeometry;
+
+//------------------------------------------------------------------------
+//
+//  Class:  FlattenedGeometryEdges
+//
+//  Synopsis:
+//      The fill outline of a geometry flattened to line edges in hit test
+//  space.  The edges are bucketed into horizontal bands so a point query
+//  only visits the edges whose vertical extent can reach the point,
+//  instead of flattening every curve of the geometry again.  The edges
+//  are only valid for the transform they were built with, and the owning
+//  geometry discards them whenever it is dirtied.
+//
+//------------------------------------------------------------------------
+
+class FlattenedGeometryEdges
+{
+public:
+    static _Check_return_ HRESULT Create(
+        _In_ CGeometry* pGeometry,
+        _In_opt_ const CMILMatrix* pTransform,
+        XFLOAT tolerance,
+        _Out_ std::unique_ptr<FlattenedGeometryEdges>* ppEdges
+        );
+
+    bool IsValidFor(
+        _In_opt_ const CMILMatrix* pTransform,
+        XFLOAT tolerance
+        ) const;
+
+    bool HitTest(
+        const XPOINTF& target
+        ) const;
+
+private:
+    struct Edge
+    {
+        XPOINTF start;
+        XPOINTF end;
+    };
+
+    FlattenedGeometryEdges() = default;
+
+    void BuildBands();
+
+    XUINT32 GetBand(XFLOAT y) const;
+
+    friend class FlattenedEdgeHitTestHelper;
+    friend class FlattenedEdgeGeometrySink;
+
+    static constexpr XUINT32 s_maxBandCount = 4096;
+
+    CMILMatrix m_transform = CMILMatrix(true);
+    XFLOAT m_tolerance = 0.0f;
+    bool m_isAlternateFill = true;
+    bool m_encounteredNaN = false;
+
+    std::vector<Edge> m_edges;
+
+    // Bounds of all edges, grown by the tolerance.
+    XRECTF_RB m_bounds = {};
+    XFLOAT m_bandHeight = 0.0f;
+    XUINT32 m_bandCount = 0;
+
+    // The edges of band i are m_bandEdges[m_bandStarts[i]] up to, but not
+    // including, m_bandEdges[m_bandStarts[i + 1]].
+    std::vector<XUINT32> m_bandStarts;
+    std::vector<XUINT32> m_bandEdges;
+};
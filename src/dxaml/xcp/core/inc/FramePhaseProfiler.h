@@ -0,0 +1,99 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include "CircularMemoryLogger.h"
+#include <Clock.h>
+#include <array>
+#include <cstdint>
+#include <vector>
+
+enum class FramePhase : std::uint8_t
+{
+    Tick,           // Timers, storyboards and the events raised while ticking them
+    Layout,         // CLayoutManager::UpdateLayout
+    RenderWalk,     // CCoreServices::RenderWalk
+    SubmitFrame,    // Submitting the composition commands for the frame
+    Count
+};
+
+constexpr std::size_t c_framePhaseCount = static_cast<std::size_t>(FramePhase::Count);
+
+struct FramePhaseProfile
+{
+    unsigned int frameNumber;
+    std::uint32_t totalMicroseconds;
+    std::array<std::uint32_t, c_framePhaseCount> phaseMicroseconds;
+    std::uint32_t elementsMeasured;
+    std::uint32_t elementsArranged;
+    std::uint32_t elementsRendered;
+};
+
+struct FramePhaseStatistics
+{
+    std::uint16_t frameCount;
+    std::uint32_t totalP50Microseconds;
+    std::uint32_t totalP99Microseconds;
+    std::array<std::uint32_t, c_framePhaseCount> phaseP50Microseconds;
+    std::array<std::uint32_t, c_framePhaseCount> phaseP99Microseconds;
+};
+
+// Always-on record of where the time of the most recent UI thread frames went, so a hitch can be attributed to a
+// phase without an ETW trace. A frame costs a handful of clock reads, and the history is a fixed size ring buffer
+// that is never allocated or locked. It belongs to one CCoreServices and is only used on its UI thread.
+//
+// Phase times are exclusive: a phase that starts while another is running (e.g. layout forced by an event handler
+// during the tick) pauses the outer phase. Work done between frames, like an app calling UpdateLayout from a
+// dispatcher callback, is attributed to the next frame.
+class FramePhaseProfiler
+{
+public:
+    static constexpr std::uint16_t c_maxFrames = 256;
+
+    class PhaseScope
+    {
+    public:
+        PhaseScope(_In_ FramePhaseProfiler* profiler, FramePhase phase);
+        ~PhaseScope();
+
+        PhaseScope(const PhaseScope&) = delete;
+        PhaseScope& operator=(const PhaseScope&) = delete;
+
+    private:
+        FramePhaseProfiler* m_profiler;
+        FramePhase m_previousPhase;
+    };
+
+    FramePhaseProfiler() = default;
+    FramePhaseProfiler(const FramePhaseProfiler&) = delete;
+    FramePhaseProfiler& operator=(const FramePhaseProfiler&) = delete;
+
+    void BeginFrame();
+    void EndFrame(unsigned int frameNumber, std::uint32_t elementsRendered);
+
+    void OnElementMeasured() { ++m_elementsMeasured; }
+    void OnElementArranged() { ++m_elementsArranged; }
+
+    // Copies up to maxFrames of the most recent frames into frames, newest first.
+    void GetRecentFrames(std::uint16_t maxFrames, _Out_ std::vector<FramePhaseProfile>* frames) const;
+
+    // Median and 99th percentile of each phase over up to maxFrames of the most recent frames.
+    FramePhaseStatistics GetStatistics(std::uint16_t maxFrames) const;
+
+private:
+    using Clock = Jupiter::HighResolutionClock;
+
+    void SwitchPhase(FramePhase phase);
+
+    CircularMemoryLogger<c_maxFrames, FramePhaseProfile> m_frames;
+
+    Clock::time_point m_frameStart;
+    Clock::time_point m_phaseStart;
+    FramePhase m_activePhase = FramePhase::Count;
+    bool m_isInFrame = false;
+
+    std::array<Clock::duration, c_framePhaseCount> m_phaseTimes {};
+    std::uint32_t m_elementsMeasured = 0;
+    std::uint32_t m_elementsArranged = 0;
+};
@@ -45,6 +45,35 @@ private:
         bool m_isColumnDefinition;
     };
 
+    // Per-cell results of the last complete measure pass.
+    struct MeasureCacheEntry
+    {
+        CUIElement* m_child;
+        unsigned int m_rowIndex;
+        unsigned int m_columnIndex;
+        unsigned int m_rowSpan;
+        unsigned int m_columnSpan;
+
+        // Constraint the child was measured with, and the desired size it returned.
+        XSIZEF m_availableSize;
+        XSIZEF m_desiredSize;
+    };
+
+    // Inputs and results of the last complete measure pass, allowing a later pass to be satisfied
+    // without re-running the cell groups sequence when none of the children changed their desired size.
+    struct MeasureCache
+    {
+        XSIZEF m_availableSize = {};
+        XSIZEF m_combinedThickness = {};
+        XSIZEF m_desiredSize = {};
+        float m_rowSpacing = 0.0f;
+        float m_columnSpacing = 0.0f;
+        float m_layoutRoundingScale = 0.0f;
+        bool m_useLayoutRounding = false;
+        bool m_isValid = false;
+        std::vector<MeasureCacheEntry> m_entries;
+    };
+
     static constexpr size_t c_spanStoreStackVectorSize = 16;
     static constexpr size_t c_cellCacheStackVectorSize = 16;
 
@@ -107,7 +136,31 @@ private:
         const CellUnitTypes columnWidthTypes,
         const bool forceRowToInfinity,
         const float rowSpacing,
-        const float columnSpacing);
+        const float columnSpacing,
+        _Out_ XSIZEF& availableSize);
+
+    _Check_return_ HRESULT TryMeasureFromCache(
+        const XSIZEF availableSize,
+        const XSIZEF combinedThickness,
+        _In_ const CUIElementCollectionWrapper& children,
+        _Out_ XSIZEF& desiredSize,
+        _Out_ bool* measuredFromCache);
+
+    void UpdateMeasureCache(
+        const XSIZEF availableSize,
+        const XSIZEF combinedThickness,
+        const XSIZEF desiredSize,
+        _In_ const CellCacheStackVector& cellCacheVector);
+
+    void InvalidateMeasureCache()
+    {
+        if (m_measureCache)
+        {
+            m_measureCache->m_isValid = false;
+        }
+    }
+
+    float GetLayoutRoundingScale();
 
     CellUnitTypes GetLengthTypeForRange(
         _In_ const CDOCollection* const definitions,
@@ -215,6 +268,7 @@ public:
     void InvalidateDefinitions()
     {
         SetGridFlags(GridFlags::DefinitionsChanged);
+        InvalidateMeasureCache();
     }
 
 public:
@@ -225,11 +279,12 @@ private:
     CRowDefinitionCollection* m_pRows = nullptr;                    // Effective row collection.
     CColumnDefinitionCollection* m_pColumns = nullptr;              // Effective column collection.
 
-                                                                    // This is a temporary storage that is released after arrange.
-    // Note the ScopeExit in ArrangeOveride
+    // Scratch storage used while resolving star and span sizes. It is kept across layout passes
+    // and only grows when the number of definitions does.
     CDefinitionBase** m_ppTempDefinitions = nullptr;                // Temporary definitions storage.
     XUINT32 m_cTempDefinitions = 0;                                 // Size in elements of temporary definitions storage
 
+    std::unique_ptr<MeasureCache> m_measureCache;                   // Results of the last complete measure pass.
 
     GridFlags m_gridFlags = GridFlags::None;                        // Internal grid flags used for layout processing. Should have enough bits to fit all flags set by SetGridFlag.
 };
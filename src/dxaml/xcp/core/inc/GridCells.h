@@ -27,6 +27,9 @@ struct CellCache
     // definitions within the column span of this cell.
     CellUnitTypes m_columnWidthTypes;
 
+    // Constraint the child was last measured with.
+    XSIZEF m_availableSize;
+
     static bool IsStar(CellUnitTypes unitTypes)
     {
         return (unitTypes & CellUnitTypes::Star) == CellUnitTypes::Star;
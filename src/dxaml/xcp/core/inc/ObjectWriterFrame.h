@@ -61,6 +61,11 @@ class ObjectWriterFrame final
 
             return *this;
         }
+
+        void Reset()
+        {
+            *this = FrameOverflowStorage();
+        }
     };
 
     struct FrameLegacyStorage
@@ -97,8 +102,112 @@ class ObjectWriterFrame final
 
             return *this;
         }
+
+        void Reset()
+        {
+            m_qoCollection.reset();
+            m_qoValue.reset();
+            m_spDirectiveValuesMap.reset();
+            m_fIsObjectFromMember = false;
+
+            // Always drop the assigned properties list, even if nothing else holds it: frame copies share the
+            // list, so an empty one kept here would be shared by the next frame's copies and collect their
+            // assignments.
+            m_spAssignedProperties.reset();
+        }
+    };
+
+    // Frames are pushed and popped for every object and member node written, and most of them need one or
+    // both of the storage blocks above. Released blocks are cleared and kept in a small per-thread cache so
+    // that subsequent frames, including those of later parses and template expansions on the same thread,
+    // reuse them instead of going back to the heap. Blocks owned by frames that outlive their parse (e.g.
+    // stack copies held by deferred content) are returned to the cache of the thread destroying them.
+    template <typename TStorage>
+    class StorageCache
+    {
+    public:
+        struct Deleter
+        {
+            void operator()(_In_ TStorage* storage) const noexcept
+            {
+                StorageCache::Release(storage);
+            }
+        };
+
+        typedef std::unique_ptr<TStorage, Deleter> storage_ptr;
+
+        static storage_ptr Acquire()
+        {
+            EnsureCleanup();
+
+            if (s_state.m_count > 0)
+            {
+                return storage_ptr(s_state.m_blocks[--s_state.m_count]);
+            }
+
+            return storage_ptr(new TStorage);
+        }
+
+        static storage_ptr Copy(_In_ const TStorage& other)
+        {
+            storage_ptr storage = Acquire();
+            *storage = other;
+            return storage;
+        }
+
+    private:
+        static constexpr UINT32 s_maxCachedCount = 32;
+
+        // Trivially destructible, so it stays usable after Cleanup ran on thread exit.
+        struct State
+        {
+            TStorage* m_blocks[s_maxCachedCount];
+            UINT32 m_count;
+            bool m_isShutDown;
+        };
+
+        struct Cleanup
+        {
+            ~Cleanup()
+            {
+                while (s_state.m_count > 0)
+                {
+                    delete s_state.m_blocks[--s_state.m_count];
+                }
+                s_state.m_isShutDown = true;
+            }
+        };
+
+        // Function-local so that its destructor is registered on a thread as soon as that thread uses the cache,
+        // whether it first acquires a block or only releases one (e.g. destroying deferred content).
+        static void EnsureCleanup() noexcept
+        {
+            static thread_local Cleanup s_cleanup;
+            (void)s_cleanup;
+        }
+
+        static void Release(_In_ TStorage* storage) noexcept
+        {
+            EnsureCleanup();
+
+            if (!s_state.m_isShutDown && s_state.m_count < s_maxCachedCount)
+            {
+                // Drop every reference held by the block before caching it.
+                storage->Reset();
+                s_state.m_blocks[s_state.m_count++] = storage;
+            }
+            else
+            {
+                delete storage;
+            }
+        }
+
+        static inline thread_local State s_state{};
     };
 
+    typedef StorageCache<FrameOverflowStorage> OverflowStorageCache;
+    typedef StorageCache<FrameLegacyStorage> LegacyStorageCache;
+
 public:
 
     ObjectWriterFrame();
@@ -110,12 +219,12 @@ public:
     {
         if (other.m_spFrameOverflowStorage)
         {
-            m_spFrameOverflowStorage.reset(new FrameOverflowStorage(*other.m_spFrameOverflowStorage));
+            m_spFrameOverflowStorage = OverflowStorageCache::Copy(*other.m_spFrameOverflowStorage);
         }
 
         if (other.m_spFrameLegacyStorage)
         {
-            m_spFrameLegacyStorage.reset(new FrameLegacyStorage(*other.m_spFrameLegacyStorage));
+            m_spFrameLegacyStorage = LegacyStorageCache::Copy(*other.m_spFrameLegacyStorage);
         }
     }
 
@@ -129,12 +238,12 @@ public:
 
             if (other.m_spFrameOverflowStorage)
             {
-                m_spFrameOverflowStorage.reset(new FrameOverflowStorage(*other.m_spFrameOverflowStorage));
+                m_spFrameOverflowStorage = OverflowStorageCache::Copy(*other.m_spFrameOverflowStorage);
             }
 
             if (other.m_spFrameLegacyStorage)
             {
-                m_spFrameLegacyStorage.reset(new FrameLegacyStorage(*other.m_spFrameLegacyStorage));
+                m_spFrameLegacyStorage = LegacyStorageCache::Copy(*other.m_spFrameLegacyStorage);
             }
         }
         return *this;
@@ -459,7 +568,7 @@ public:
     {
         if (!m_spFrameOverflowStorage)
         {
-            m_spFrameOverflowStorage.reset(new FrameOverflowStorage);
+            m_spFrameOverflowStorage = OverflowStorageCache::Acquire();
         }
     }
 
@@ -467,7 +576,7 @@ public:
     {
         if (!m_spFrameLegacyStorage)
         {
-            m_spFrameLegacyStorage.reset(new FrameLegacyStorage);
+            m_spFrameLegacyStorage = LegacyStorageCache::Acquire();
         }
     }
 
@@ -478,6 +587,6 @@ private:
     std::shared_ptr<XamlType> m_spType;
     std::shared_ptr<XamlProperty> m_spMember;
     std::shared_ptr<XamlQualifiedObject> m_qoInstance;
-    std::unique_ptr<FrameOverflowStorage> m_spFrameOverflowStorage;
-    std::unique_ptr<FrameLegacyStorage> m_spFrameLegacyStorage;
+    OverflowStorageCache::storage_ptr m_spFrameOverflowStorage;
+    LegacyStorageCache::storage_ptr m_spFrameLegacyStorage;
 };
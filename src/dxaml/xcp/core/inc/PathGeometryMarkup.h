@@ -0,0 +1,109 @@
+// Copyright (c) Microsoft Corporation. All rights reserved.
+// Licensed under the MIT License. See LICENSE in the project root for license information.
+
+#pragma once
+
+#include <xstring_ptr.h>
+
+class CGeometryBuilder;
+
+//------------------------------------------------------------------------
+//
+//  Class:  PathGeometryMarkup
+//
+//  Synopsis:
+//      The parsed form of a path mini-language string.  Parsing records
+//  each command and its numeric values once; Replay then feeds them to a
+//  CGeometryBuilder without scanning the string again.  Once parsed the
+//  markup is immutable and may be shared by every CPathGeometry created
+//  from the same string.  Replay always builds new figures and segments,
+//  so a geometry that changes its figures never affects the shared copy.
+//
+//------------------------------------------------------------------------
+
+class PathGeometryMarkup
+{
+public:
+    _Check_return_ HRESULT Parse(
+        _In_ XUINT32 cString,
+        _In_reads_(cString) const WCHAR *pString,
+        _In_ XINT32 bAllowFill
+        );
+
+    _Check_return_ HRESULT Replay(
+        _In_ CGeometryBuilder *pBuilder,
+        _Inout_ XcpFillMode *pFillMode
+        ) const;
+
+    XUINT32 GetValueCount() const
+    {
+        return static_cast<XUINT32>(m_values.size());
+    }
+
+    // Releases the capacity reserved while parsing, for markup that is kept around.
+    void ShrinkToFit()
+    {
+        m_commands.shrink_to_fit();
+        m_values.shrink_to_fit();
+    }
+
+private:
+    struct Command
+    {
+        WCHAR   cmd;        // Command marker as it appeared in the markup
+        XUINT8  iFirst;     // Index in the numeric buffer of the first value
+        XUINT8  cValues;    // Count of values recorded for this command
+        XUINT32 iValue;     // Index of the first value in m_values
+    };
+
+    void AddCommand(
+        WCHAR cmd,
+        XUINT32 iFirst,
+        XUINT32 cValues,
+        _In_reads_(cValues) const XFLOAT *pValues
+        );
+
+    std::vector<Command> m_commands;
+
+    // Boolean arc and fill values are stored as the XINT32 bit pattern the
+    // builder expects, so this buffer is copied into the builder untouched.
+    std::vector<XFLOAT> m_values;
+
+    bool m_hasFillMode = false;
+    XcpFillMode m_fillMode = XcpFillModeAlternate;
+};
+
+//------------------------------------------------------------------------
+//
+//  Class:  PathGeometryMarkupCache
+//
+//  Synopsis:
+//      Core wide cache of parsed path markup keyed by the markup string.
+//  Icon glyphs and templated paths instantiate the same few strings many
+//  times, so after the first parse each CPathGeometry only replays the
+//  cached commands.  The cache is bounded by the total count of recorded
+//  values and is emptied when that budget would be exceeded.
+//
+//------------------------------------------------------------------------
+
+class PathGeometryMarkupCache
+{
+public:
+    _Check_return_ HRESULT GetMarkup(
+        _In_ const xstring_ptr& strMarkup,
+        _Out_ std::shared_ptr<const PathGeometryMarkup> *pspMarkup
+        );
+
+    void Clear()
+    {
+        m_entries.clear();
+        m_cCachedValues = 0;
+    }
+
+private:
+    static constexpr XUINT32 s_maxEntries = 1024;
+    static constexpr XUINT32 s_maxCachedValues = 256 * 1024;
+
+    std::unordered_map<xstring_ptr, std::shared_ptr<const PathGeometryMarkup>> m_entries;
+    XUINT32 m_cCachedValues = 0;
+};
@@ -357,9 +357,14 @@ public:
         return m_isHighContrast;
     }
 
+    // Also invalidates the merged resource index, since an added key can hide one found in a merged dictionary.
     void InvalidateNotFoundCache(bool propagate);
     void InvalidateNotFoundCache(bool propagate, const ResourceKey& key);
 
+    // Invalidates the merged resource index of this dictionary and the dictionaries above it, when a merged
+    // dictionary is removed.
+    void InvalidateMergedResourceIndex();
+
     _Check_return_
     HRESULT DeferKeysAsXaml(
         _In_ const bool fIsDictionaryWithKeyProperty,
@@ -455,6 +460,15 @@ private:
 
     CDependencyObject* FindResourceByKey(_In_ const ResourceKey& key) const;
 
+    CDependencyObject* FindInMergedResourceIndex(
+        const ResourceKey& key,
+        _Out_opt_ xref_ptr<CResourceDictionary>* dictionaryReadFrom) const;
+
+    void AddToMergedResourceIndex(
+        const ResourceKey& key,
+        _In_ CResourceDictionary* dictionaryReadFrom,
+        _In_ CDependencyObject* value);
+
     // Warning: This method breaks standard return object ownership
     // semantics. The returned out pointer does NOT transfer ownership
     // to the caller, instead lifetime is preserved via the key dictionary.
@@ -499,6 +513,16 @@ private:
 
     std::unique_ptr<Resources::details::ResourceKeyCache> m_keysNotFoundCache;
 
+    struct MergedResourceIndexEntry
+    {
+        xref_ptr<CResourceDictionary> m_dictionaryReadFrom;
+        CDependencyObject* m_value; // No ref, the value is kept alive by m_dictionaryReadFrom.
+    };
+
+    // Keys found in the merged dictionaries, mapped to the dictionary they were found in, so lookups that come
+    // back for them don't search through every merged dictionary again. Only used where m_keysNotFoundCache is.
+    std::unique_ptr<std::unordered_map<ResourceKeyStorage, MergedResourceIndexEntry>> m_mergedResourceIndex;
+
     unsigned int m_bHasKey                     : 1;
     unsigned int m_bAllowItems                 : 1;
     unsigned int m_bIsThemeDictionaries        : 1; // Represents ResourceDictionary.ThemeDictionaries
@@ -212,6 +212,9 @@ private:
         float durationValue
         );
 
+    void EnsureKeyFramePercents(const CDOCollection::storage_type& sortedKeyFrames);
+    XUINT32 GetKeyFrameSegment(XFLOAT rProgress);
+
     _Check_return_ HRESULT DoAnimationValueOperation(
         _In_ CValue& value,
         AnimationValueOperation operation,
@@ -228,6 +231,11 @@ public:
     // C<*>UsingKeyFrames properties
     CKeyFrameCollection *m_pKeyFrames;  // Mutually exclusive with use of m_pBy.
 
+    // Key times of the sorted key frames as a percentage of the duration, resolved on the first tick after
+    // Begin, and the segment found on the last tick. Segment i lies between key frames i - 1 and i.
+    std::vector<XFLOAT> m_keyFramePercents;
+    XUINT32 m_keyFrameSegmentCursor = 0;
+
     // Easing function for the animation.
     // Native easing functions all derive from CEasingFunctionBase. Managed ones must implement IEasingFunction.
     CDependencyObject *m_pEasingFunction;
@@ -28,6 +28,7 @@
 #include "InitializationType.h"
 #include <ContentRootCoordinator.h>
 #include "CircularMemoryLogger.h"
+#include "FramePhaseProfiler.h"
 #include "ImageProvider.h"
 #include "AsyncImageFactory.h"
 #include "ResourceLookupLogger.h"
@@ -63,6 +64,7 @@ class CEventManager;
 class CInputServices;
 class CGeometryBuilder;
 class CGlyphPathBuilder;
+class PathGeometryMarkupCache;
 class CDependencyObject;
 class CEnumerated;
 class CDouble;
@@ -1217,6 +1219,9 @@ public:
 
     _Check_return_ HRESULT GetGlyphPathBuilder(_Outptr_ CGlyphPathBuilder **ppBuilder);
 
+    // Parsed path markup shared by every CPathGeometry created from the same string
+    PathGeometryMarkupCache& GetPathGeometryMarkupCache();
+
     _Check_return_ HRESULT GetTextCore(_Outptr_result_maybenull_ CTextCore **ppTextCore);
 
     _Check_return_ CLayoutManager* GetMainLayoutManager()
@@ -1736,6 +1741,8 @@ public:
 
     Diagnostics::ResourceLookupLogger* GetResourceLookupLogger();
 
+    FramePhaseProfiler& GetFramePhaseProfiler() { return m_framePhaseProfiler; }
+
 public:
     XUINT32                  m_uFrameNumber;
     int                      m_framesToSkip = 0;
@@ -1793,6 +1800,8 @@ private:
     XINT32                      m_bBuilderReady[2]; // We keep 2 scratch builders for use in widening, parsing, or other path building
     CGeometryBuilder           *m_pBuilder[2];
     CGlyphPathBuilder          *m_pGlyphPathBuilder;
+    std::unique_ptr<PathGeometryMarkupCache>
+                                m_pathGeometryMarkupCache;
     CTextCore                  *m_pTextCore;
     xref_ptr<CBrush>            m_defaultTextBrush;
     xref_ptr<CBrush>            m_textSelectionGripperFillBrush;
@@ -1967,6 +1976,9 @@ private:
 
     CircularMemoryLogger<32, CoreServicesEventLog> m_coreServicesEventLog;
 
+    // Phase timings of the most recent frames drawn by NWDrawTree.
+    FramePhaseProfiler m_framePhaseProfiler;
+
     // Note: this object is on a very hot code path (250k+ logger accesses just opening a new File Explorer window).
     // One of these exists for each UI thread.
     std::unique_ptr<Diagnostics::ResourceLookupLogger> m_resourceLookupLogger;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include "palnetwork.h"
+#include <array>
 
 // Need to forward reference the args
 class CEventArgs;
@@ -318,11 +319,21 @@ private:
 
     _Check_return_ HRESULT GetParentForRoutedEventBubbling(EventHandle hEvent, _In_ CDependencyObject* currentObject, _In_ CDependencyObject** parentObject);
 
+    // Whether any object has a request for the event, so raising it can skip looking up the sender's requests.
+    bool HasRequests(_In_ EventHandle hEvent) const
+    {
+        return static_cast<XUINT32>(hEvent.index) >= KnownEventCount
+            || m_requestCounts[static_cast<XUINT32>(hEvent.index)] > 0;
+    }
+
+    void OnRequestRemoved(_In_ const REQUEST* pRequest);
+
 private:
     std::vector<xref_ptr<CUIElement>> m_topDownPathToSource;
 
     XUINT32                     m_cRef;
     CEventRequestMap           *m_pRequest;
+    std::array<XUINT32, KnownEventCount> m_requestCounts {};  // Number of requests in m_pRequest for each event
     IPALQueue                  *m_pSlowQueue;
     IPALQueue                  *m_pFastQueue;
     CDependencyObjectVector*    m_pLoadedEventList;
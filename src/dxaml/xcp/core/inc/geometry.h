@@ -11,6 +11,7 @@
 #include "DOCollection.h"
 #include "D2D1.h"
 #include "ComTemplates.h"
+#include "FlattenedGeometryEdges.h"
 #include <windows.graphics.interop.h>
 #include <microsoft.ui.composition.h>
 #include <microsoft.ui.composition.experimental.h>
@@ -273,6 +274,11 @@ public:
     _Check_return_ HRESULT LeaveImpl(_In_ CDependencyObject *pNamescopeOwner, LeaveParams params) override;
     void ReleaseDCompResources() override;
 
+protected:
+    void NWPropagateDirtyFlag(DirtyFlags flags) override;
+
+public:
+
     //-----------------------------------------------------------------------------
     //
     //  Bounds and Hit Testing
@@ -294,6 +300,11 @@ public:
         _Out_ bool* pContainsPoint
         );
 
+    // Drops the flattened fill edges kept for hit testing. Shapes that update
+    // their render geometry in place must call this, since those updates don't
+    // go through the geometry's dirty flags.
+    void InvalidateHitTestCache();
+
     virtual _Check_return_ HRESULT HitTestFill(
         _In_ const XPOINTF& target,
         _In_opt_ const CMILMatrix* pTransform,
@@ -367,6 +378,10 @@ public:
 private:
     bool m_isWUCGeometryDirty : 1;
 
+    // Flattened fill edges from the last point hit test, reused while the
+    // geometry and hit test transform are unchanged.
+    std::unique_ptr<FlattenedGeometryEdges> m_flattenedFillEdges;
+
 protected:
     wrl::ComPtr<WUComp::ICompositionGeometry> m_wucGeometry;
 
@@ -576,14 +591,6 @@ protected:
         IPALAcceleratedGeometry** ppGeometry
         ) override;
 
-private:
-    _Check_return_ HRESULT ParseGeometry(
-        _In_ CGeometryBuilder *pBuilder,
-        _In_ XUINT32 cString,
-        _In_reads_(cString) const WCHAR *pString,
-        _In_ XINT32 bAllowFill
-        );
-
 public:
     // CPathGeometry fields
     CPathFigureCollection *m_pFigures;
@@ -4,6 +4,7 @@
 #pragma once
 
 #include <Framework.h>
+#include "ChildBoundsGrid.h"
 
 //------------------------------------------------------------------------
 //
@@ -80,6 +81,8 @@ public:
 
     XCORNERRADIUS GetCornerRadius() const override;
 
+    void InvalidateChildBoundsGrid();
+
 protected:
     _Check_return_ CTransitionCollection* GetTransitionsForChildElementNoAddRef(_In_ CUIElement* pChild) override;
 
@@ -123,6 +126,35 @@ protected:
         _Out_ bool* pHit
         ) override;
 
+    _Check_return_ HRESULT BoundsTestChildren(
+        _In_ const XPOINTF& target,
+        _In_ CBoundedHitTestVisitor* pCallback,
+        _In_opt_ const HitTestParams *hitTestParams,
+        _In_ bool canHitDisabledElements,
+        _In_ bool canHitInvisibleElements,
+        _Out_opt_ BoundsWalkHitResult* pResult
+        ) override;
+
+    _Check_return_ HRESULT BoundsTestChildren(
+        _In_ const HitTestPolygon& target,
+        _In_ CBoundedHitTestVisitor* pCallback,
+        _In_opt_ const HitTestParams *hitTestParams,
+        _In_ bool canHitDisabledElements,
+        _In_ bool canHitInvisibleElements,
+        _Out_opt_ BoundsWalkHitResult* pResult
+        ) override;
+
+private:
+    template <typename HitType>
+    _Check_return_ HRESULT BoundsTestChildrenWithGrid(
+        _In_ const HitType& target,
+        _In_ CBoundedHitTestVisitor* pCallback,
+        _In_opt_ const HitTestParams *hitTestParams,
+        _In_ bool canHitDisabledElements,
+        _In_ bool canHitInvisibleElements,
+        _Out_opt_ BoundsWalkHitResult* pResult
+        );
+
 public:
     // CPanel fields
 
@@ -131,4 +163,11 @@ public:
 private:
     bool m_fNWBackgroundDirty : 1;
     bool m_fNWBorderBrushDirty : 1;
+
+    // Set once the children are bounds tested with clean child bounds. The grid is
+    // only built on the next test, so panels whose children move every frame never
+    // pay for building it.
+    bool m_fChildrenBoundsTested : 1;
+
+    std::unique_ptr<ChildBoundsGrid> m_childBoundsGrid;
 };
@@ -333,6 +333,13 @@ private:
         _Out_ bool* isReverse,
         _Outptr_ ITransformer** returnValue);
 
+    // Same mapping as TransformToVisual, but only succeeds for pure 2D translations,
+    // which it returns without creating a transform object.
+    _Check_return_ HRESULT TryGetTranslationToVisual(
+        _In_opt_ CUIElement* pVisual,
+        _Out_ bool* isTranslation,
+        _Out_ XPOINTF* translation);
+
 public:
     // GetClickablePoint for AutomationPeer
     _Check_return_ HRESULT GetClickablePointRasterizedClient(_Out_ XPOINTF *pPoint);
@@ -1568,17 +1575,31 @@ public:
     class TransformToPreviousViewport
     {
     public:
-        TransformToPreviousViewport(_In_ CUIElement* element, _In_ xref_ptr<CGeneralTransform> transform)
+        TransformToPreviousViewport(
+            _In_ CUIElement* element,
+            _In_ xref_ptr<CGeneralTransform> transform,
+            const bool isTranslationToGlobal,
+            const XPOINTF& translationToGlobal)
             : m_elementNoRef(element)
             , m_transform(transform)
+            , m_isTranslationToGlobal(isTranslationToGlobal)
+            , m_translationToGlobal(translationToGlobal)
         {}
 
         CUIElement* GetElement() const { return m_elementNoRef; }
         xref_ptr<CGeneralTransform> GetTransform() const { return m_transform; }
 
+        // True when this viewport and all the previous ones are only translated
+        // relative to their previous viewport, in which case GetTranslationToGlobal
+        // is the combined transform from this viewport up to global coordinates.
+        bool IsTranslationToGlobal() const { return m_isTranslationToGlobal; }
+        const XPOINTF& GetTranslationToGlobal() const { return m_translationToGlobal; }
+
     private:
         CUIElement* m_elementNoRef;
         xref_ptr<CGeneralTransform> m_transform;
+        bool m_isTranslationToGlobal;
+        XPOINTF m_translationToGlobal;
     };
 
 
@@ -1725,7 +1746,7 @@ private:
         double horizontalOffset,
         double verticalOffset);
 
-    void SetChildRenderOrderDirty();
+    void SetChildRenderOrderDirty(_In_ CUIElement* pChild);
 
 public:
     static void NWSetVisibilityDirty(_In_ CDependencyObject *pTarget, DirtyFlags flags);
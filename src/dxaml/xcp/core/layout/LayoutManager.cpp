@@ -170,6 +170,8 @@ CLayoutManager::EnterMeasure(_In_ CUIElement* pElement)
     if (++m_cMeasuresOnStack > MaxLayoutDepth)
         IFC_RETURN(E_FAIL);
 
+    m_pCoreServices->GetFramePhaseProfiler().OnElementMeasured();
+
     m_firePostLayoutEvents = TRUE;
 
     return S_OK;
@@ -193,6 +195,8 @@ CLayoutManager::EnterArrange(_In_ CUIElement* pElement)
     if (++m_cArrangesOnStack > MaxLayoutDepth)
         IFC_RETURN(E_FAIL);
 
+    m_pCoreServices->GetFramePhaseProfiler().OnElementArranged();
+
     m_firePostLayoutEvents = TRUE;
 
     return S_OK;
@@ -250,6 +254,8 @@ CLayoutManager::UpdateLayout(XUINT32 controlWidth, XUINT32 controlHeight)
 
     TraceLayoutBegin();
 
+    FramePhaseProfiler::PhaseScope layoutPhase(&m_pCoreServices->GetFramePhaseProfiler(), FramePhase::Layout);
+
     XUINT32 count = MaxLayoutIterations;
     std::wstring extraInfoEntries[WarningLayoutIterations];
     bool previousCoreIsLayoutCycleTrackingActive = false;
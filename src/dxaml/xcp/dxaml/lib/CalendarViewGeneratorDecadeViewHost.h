@@ -43,6 +43,11 @@ namespace DirectUI
         _Check_return_ HRESULT GetLastUnitInThisScope(_Out_ int* pValue) override;
         _Check_return_ HRESULT OnScopeChanged() override;
 
+        INT64 GetCivilUnit(_In_ int year, _In_ int month, _In_ int day) override
+        {
+            return year;
+        }
+
         _Check_return_ HRESULT UpdateLabel(_In_ CalendarViewBaseItem* pItem, _In_ bool isLabelVisible) override
         {
             // DecadeView doesn't have a Label
@@ -169,7 +169,9 @@ _Check_return_ IFACEMETHODIMP CalendarViewGeneratorHost::SuggestContainerForCont
 
 
 CalendarViewGeneratorHost::CalendarViewGeneratorHost()
-    : m_size(0)
+    : m_useCivilArithmetic(false)
+    , m_civilUnitOfMinDate(0)
+    , m_size(0)
     , m_pOwnerNoRef(nullptr)
 {
     ResetScope();
@@ -209,7 +211,7 @@ void CalendarViewGeneratorHost::ResetScope()
     m_lastVisibleIndicesPair[1] = -1;
     m_lastVisitedDateAndIndex.first.UniversalTime = 0;
     m_lastVisitedDateAndIndex.second = -1;
-
+    m_dateAnchors.clear();
 }
 
 xaml::Thickness CalendarViewGeneratorHost::GetItemMargin() const
@@ -244,9 +246,12 @@ _Check_return_ HRESULT CalendarViewGeneratorHost::ComputeSize()
 
     m_lastVisitedDateAndIndex.first = GetOwner()->GetMinDate();
     m_lastVisitedDateAndIndex.second = 0;
+    m_dateAnchors.clear();
 
     ASSERT(!GetOwner()->GetDateComparer()->LessThan(GetOwner()->GetMaxDate(), GetOwner()->GetMinDate()));
 
+    IFC(UpdateCivilArithmetic());
+
     IFC(CalculateOffsetFromMinDate(GetOwner()->GetMaxDate(), &index));
 
     m_size = static_cast<UINT>(index)+1;
@@ -288,6 +293,9 @@ _Check_return_ HRESULT CalendarViewGeneratorHost::AddUnits(_Inout_ wf::DateTime&
 // generate the items continuously so we can cache the result from last call and
 // call AddUnits from the cache - this way N is small enough
 // time cost: amortized O(1)
+// For random access (e.g. jumping to a far date), we either compute the date
+// from its Gregorian day number, or start from the closest anchor so N stays
+// below GetMaximumScopeSize(): O(log n) to find the anchor.
 
 _Check_return_ HRESULT CalendarViewGeneratorHost::GetDateAt(_In_ UINT index, _Out_ wf::DateTime* pDate)
 {
@@ -302,9 +310,63 @@ _Check_return_ HRESULT CalendarViewGeneratorHost::GetDateAt(_In_ UINT index, _Ou
     {
         wf::DateTime date = {};
         auto pCalendar = GetCalendar();
+        int year = 0;
+        int month = 0;
+        int day = 0;
+
+        if (m_useCivilArithmetic &&
+            std::abs(static_cast<int>(index) - m_lastVisitedDateAndIndex.second) > 1 &&
+            GetCivilDateOfUnit(m_civilUnitOfMinDate + index, &year, &month, &day))
+        {
+            // Keep the time of the day of the visited dates, only move the date.
+            // The day goes to 1 first so that no intermediate date is invalid.
+            IFC_RETURN(pCalendar->SetDateTime(m_lastVisitedDateAndIndex.first));
+            IFC_RETURN(pCalendar->put_Day(1));
+            IFC_RETURN(pCalendar->put_Year(year));
+            IFC_RETURN(pCalendar->put_Month(month));
+            IFC_RETURN(pCalendar->put_Day(day));
+
+#ifdef DBG
+            // The arithmetic must land on the same day as walking the calendar does.
+            {
+                wf::DateTime civilDate = {};
+                int walkedYear = 0;
+                int walkedMonth = 0;
+                int walkedDay = 0;
+
+                IFC_RETURN(pCalendar->GetDateTime(&civilDate));
+                IFC_RETURN(pCalendar->SetDateTime(m_lastVisitedDateAndIndex.first));
+                IFC_RETURN(AddUnits(static_cast<int>(index) - m_lastVisitedDateAndIndex.second));
+                IFC_RETURN(pCalendar->get_Year(&walkedYear));
+                IFC_RETURN(pCalendar->get_Month(&walkedMonth));
+                IFC_RETURN(pCalendar->get_Day(&walkedDay));
+                ASSERT(walkedYear == year && walkedMonth == month && walkedDay == day);
+                IFC_RETURN(pCalendar->SetDateTime(civilDate));
+            }
+#endif
+        }
+        else
+        {
+            auto closestDateAndIndex = GetClosestVisitedDateAndIndex(static_cast<int>(index));
+            const int maxScopeSize = GetMaximumScopeSize();
+
+            // Remember the item at the start of the stride holding the index, so later
+            // visits of this part of the calendar don't have to walk this far again.
+            if (std::abs(static_cast<int>(index) - closestDateAndIndex.second) > maxScopeSize)
+            {
+                const int anchorIndex = static_cast<int>(index) - static_cast<int>(index) % maxScopeSize;
+
+                IFC_RETURN(pCalendar->SetDateTime(closestDateAndIndex.first));
+                IFC_RETURN(AddUnits(anchorIndex - closestDateAndIndex.second));
+                IFC_RETURN(pCalendar->GetDateTime(&closestDateAndIndex.first));
+                closestDateAndIndex.second = anchorIndex;
+                AddDateAnchor(anchorIndex, closestDateAndIndex.first);
+            }
+
+            IFC_RETURN(pCalendar->SetDateTime(closestDateAndIndex.first));
+            IFC_RETURN(AddUnits(static_cast<int>(index) - closestDateAndIndex.second));
+        }
 
-        IFC_RETURN(pCalendar->SetDateTime(m_lastVisitedDateAndIndex.first));
-        IFC_RETURN(AddUnits(static_cast<int>(index) - m_lastVisitedDateAndIndex.second));
         IFC_RETURN(pCalendar->GetDateTime(&date));
         m_lastVisitedDateAndIndex.first = date;
         m_lastVisitedDateAndIndex.second = static_cast<int>(index);
@@ -314,20 +376,57 @@ _Check_return_ HRESULT CalendarViewGeneratorHost::GetDateAt(_In_ UINT index, _Ou
     return S_OK;
 }
 
-// to get the distance of two days, here are the amortized O(1) method
+// For the Gregorian calendar, the offset is the difference between the day
+// (month, year) numbers of the two dates.
+// Otherwise, to get the distance of two days, here are the amortized O(1) method
 //1. Estimate the offset of Date2 from Date1 by dividing their UTC difference by 24 hours
 //2. Call Globalization API AddDays(Date1, offset) to get an estimated date, let's say EstimatedDate, here offset comes from step1
 //3. Compute the distance between EstimatedDate and Date2(keep adding 1 day on the smaller one, until we hit the another date),
 //   if this distance is still big, we can do step 1 and 2 one more time
 //4. Return the sum of results from step1 and step3.
+// Date1 is the last visited date or the closest anchor to the estimated index.
 
 _Check_return_ HRESULT CalendarViewGeneratorHost::CalculateOffsetFromMinDate(_In_ wf::DateTime date, _Out_ int* pIndex)
 {
     *pIndex = 0;
-    wf::DateTime estimatedDate = { m_lastVisitedDateAndIndex.first.UniversalTime };
     auto pCalendar = GetCalendar();
     ASSERT(m_lastVisitedDateAndIndex.second != -1);
 
+    if (m_useCivilArithmetic)
+    {
+        int year = 0;
+        int month = 0;
+        int day = 0;
+
+        IFC_RETURN(pCalendar->SetDateTime(date));
+        IFC_RETURN(pCalendar->get_Year(&year));
+        IFC_RETURN(pCalendar->get_Month(&month));
+        IFC_RETURN(pCalendar->get_Day(&day));
+
+        *pIndex = static_cast<int>(GetCivilUnit(year, month, day) - m_civilUnitOfMinDate);
+
+#ifdef DBG
+        // Where a unit is a single day, mapping the index back must give the same date.
+        {
+            int civilYear = 0;
+            int civilMonth = 0;
+            int civilDay = 0;
+
+            if (GetCivilDateOfUnit(m_civilUnitOfMinDate + *pIndex, &civilYear, &civilMonth, &civilDay))
+            {
+                ASSERT(civilYear == year && civilMonth == month && civilDay == day);
+            }
+        }
+#endif
+
+        return S_OK;
+    }
+
+    auto averageTicksPerUnit = GetAverageTicksPerUnit();
+    auto baseDateAndIndex = GetClosestVisitedDateAndIndex(
+        m_lastVisitedDateAndIndex.second + static_cast<int>((date.UniversalTime - m_lastVisitedDateAndIndex.first.UniversalTime) / averageTicksPerUnit));
+    wf::DateTime estimatedDate = { baseDateAndIndex.first.UniversalTime };
+
     int estimatedOffset = 0;
     INT64 diffInUTC = 0;
     int diffInUnit = 0;
@@ -340,7 +439,6 @@ _Check_return_ HRESULT CalendarViewGeneratorHost::CalculateOffsetFromMinDate(_In
 
     // step 1: estimation. mostly we only need to up to 2 times, but if we are targeting the calendar's boundaries
     // we could need more times (uncommon scenario)
-    auto averageTicksPerUnit = GetAverageTicksPerUnit();
 #ifdef DBG
     int estimationCount = 0;
 #endif
@@ -421,11 +519,100 @@ _Check_return_ HRESULT CalendarViewGeneratorHost::CalculateOffsetFromMinDate(_In
     }
 
     // base + estimatedDiff + correction
-    *pIndex = m_lastVisitedDateAndIndex.second + estimatedOffset + offsetCorrection;
+    *pIndex = baseDateAndIndex.second + estimatedOffset + offsetCorrection;
 
     return S_OK;
 }
 
+std::pair<wf::DateTime, int> CalendarViewGeneratorHost::GetClosestVisitedDateAndIndex(_In_ int index)
+{
+    auto closestDateAndIndex = m_lastVisitedDateAndIndex;
+    auto itAnchor = m_dateAnchors.lower_bound(index);
+
+    auto pickIfCloser = [&](const std::pair<const int, wf::DateTime>& anchor)
+    {
+        if (std::abs(anchor.first - index) < std::abs(closestDateAndIndex.second - index))
+        {
+            closestDateAndIndex = std::make_pair(anchor.second, anchor.first);
+        }
+    };
+
+    if (itAnchor != m_dateAnchors.end())
+    {
+        pickIfCloser(*itAnchor);
+    }
+
+    if (itAnchor != m_dateAnchors.begin())
+    {
+        pickIfCloser(*std::prev(itAnchor));
+    }
+
+    return closestDateAndIndex;
+}
+
+void CalendarViewGeneratorHost::AddDateAnchor(_In_ int index, _In_ wf::DateTime date)
+{
+    m_dateAnchors.emplace(index, date);
+}
+
+// Gregorian arithmetic only applies when the calendar is Gregorian and every Gregorian
+// day exists in the current time zone.
+_Check_return_ HRESULT CalendarViewGeneratorHost::UpdateCivilArithmetic()
+{
+    wrl_wrappers::HString calendarSystem;
+    auto pCalendar = GetCalendar();
+
+    m_useCivilArithmetic = false;
+    m_civilUnitOfMinDate = 0;
+
+    IFC_RETURN(pCalendar->GetCalendarSystem(calendarSystem.GetAddressOf()));
+
+    if (wrl_wrappers::HStringReference(L"GregorianCalendar") == calendarSystem.Get() && CanUseCivilArithmetic())
+    {
+        int year = 0;
+        int month = 0;
+        int day = 0;
+
+        IFC_RETURN(pCalendar->SetDateTime(GetOwner()->GetMinDate()));
+        IFC_RETURN(pCalendar->get_Year(&year));
+        IFC_RETURN(pCalendar->get_Month(&month));
+        IFC_RETURN(pCalendar->get_Day(&day));
+
+        m_civilUnitOfMinDate = GetCivilUnit(year, month, day);
+        m_useCivilArithmetic = true;
+    }
+
+    return S_OK;
+}
+
+// Days since 1970-01-01 for a date in the proleptic Gregorian calendar.
+// Years are shifted to start in March so the leap day is the last day of the year.
+/* static */ INT64 CalendarViewGeneratorHost::DaysFromCivil(_In_ int year, _In_ int month, _In_ int day)
+{
+    const INT64 y = static_cast<INT64>(year) - (month <= 2 ? 1 : 0);
+    const INT64 era = (y >= 0 ? y : y - 399) / 400;
+    const INT64 yearOfEra = y - era * 400;                                          // [0, 399]
+    const INT64 dayOfYear = (153 * (month + (month > 2 ? -3 : 9)) + 2) / 5 + day - 1;  // [0, 365]
+    const INT64 dayOfEra = yearOfEra * 365 + yearOfEra / 4 - yearOfEra / 100 + dayOfYear;  // [0, 146096]
+
+    return era * 146097 + dayOfEra - 719468;
+}
+
+/* static */ void CalendarViewGeneratorHost::CivilFromDays(_In_ INT64 days, _Out_ int* pYear, _Out_ int* pMonth, _Out_ int* pDay)
+{
+    const INT64 z = days + 719468;
+    const INT64 era = (z >= 0 ? z : z - 146096) / 146097;
+    const INT64 dayOfEra = z - era * 146097;                                                      // [0, 146096]
+    const INT64 yearOfEra = (dayOfEra - dayOfEra / 1460 + dayOfEra / 36524 - dayOfEra / 146096) / 365;  // [0, 399]
+    const INT64 dayOfYear = dayOfEra - (365 * yearOfEra + yearOfEra / 4 - yearOfEra / 100);       // [0, 365]
+    const INT64 monthFromMarch = (5 * dayOfYear + 2) / 153;                                       // [0, 11]
+    const int month = static_cast<int>(monthFromMarch < 10 ? monthFromMarch + 3 : monthFromMarch - 9);
+
+    *pDay = static_cast<int>(dayOfYear - (153 * monthFromMarch + 2) / 5 + 1);
+    *pMonth = month;
+    *pYear = static_cast<int>(yearOfEra + era * 400 + (month <= 2 ? 1 : 0));
+}
+
 // return the first date of next scope.
 // parameter dateOfFirstVisibleItem is the first visible item, it could be in
 // current scope, or in previous scope.
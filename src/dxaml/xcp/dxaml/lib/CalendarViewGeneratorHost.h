@@ -262,6 +262,33 @@ namespace DirectUI
         virtual _Check_return_ HRESULT GetLastUnitInThisScope(_Out_ int* pValue) = 0;
         virtual _Check_return_ HRESULT OnScopeChanged() = 0;
 
+        // Converts a Gregorian year, month and day to a number that increases by one with
+        // each unit, so the distance between two dates in units is a subtraction.
+        virtual INT64 GetCivilUnit(_In_ int year, _In_ int month, _In_ int day) = 0;
+
+        // The inverse of GetCivilUnit. Only implemented when a unit maps to a single day,
+        // other views keep walking the calendar to pick the same day of the month it does.
+        virtual bool GetCivilDateOfUnit(_In_ INT64 unit, _Out_ int* pYear, _Out_ int* pMonth, _Out_ int* pDay)
+        {
+            *pYear = *pMonth = *pDay = 0;
+            return false;
+        }
+
+        // Whether the current time zone keeps every Gregorian day, which civil arithmetic relies on.
+        virtual bool CanUseCivilArithmetic() { return true; }
+
+        // Days since 1970-01-01 in the proleptic Gregorian calendar, and back.
+        static INT64 DaysFromCivil(_In_ int year, _In_ int month, _In_ int day);
+        static void CivilFromDays(_In_ INT64 days, _Out_ int* pYear, _Out_ int* pMonth, _Out_ int* pDay);
+
+    private:
+        _Check_return_ HRESULT UpdateCivilArithmetic();
+
+        // Returns the visited date closest to the given index: the last visited date or an anchor.
+        std::pair<wf::DateTime, int> GetClosestVisitedDateAndIndex(_In_ int index);
+
+        void AddDateAnchor(_In_ int index, _In_ wf::DateTime date);
+
     public:
         _Check_return_ HRESULT AdjustToFirstUnitInThisScope(_Out_ wf::DateTime* pDate, _Out_opt_ int* pUnit = nullptr);
         _Check_return_ HRESULT AdjustToLastUnitInThisScope(_Out_ wf::DateTime* pDate, _Out_opt_ int* pUnit = nullptr);
@@ -271,6 +298,14 @@ namespace DirectUI
         wf::DateTime m_minDateOfCurrentScope;
         wf::DateTime m_maxDateOfCurrentScope;
         std::pair<wf::DateTime, int> m_lastVisitedDateAndIndex;
+
+        // For the Gregorian calendar, item indexes are computed from the year, month and day
+        // of the dates. For other calendars, the dates of items at multiples of
+        // GetMaximumScopeSize() are remembered once visited, so mapping an index to a date
+        // walks less than a scope from the closest known date.
+        bool m_useCivilArithmetic;
+        INT64 m_civilUnitOfMinDate;
+        std::map<int, wf::DateTime> m_dateAnchors;
         wrl_wrappers::HString m_pHeaderText;
         UINT m_size;
 
@@ -100,6 +100,23 @@ namespace DirectUI
         _Check_return_ HRESULT GetLastUnitInThisScope(_Out_ int* pValue) override;
         _Check_return_ HRESULT OnScopeChanged() override;
 
+        INT64 GetCivilUnit(_In_ int year, _In_ int month, _In_ int day) override
+        {
+            return DaysFromCivil(year, month, day);
+        }
+
+        bool GetCivilDateOfUnit(_In_ INT64 unit, _Out_ int* pYear, _Out_ int* pMonth, _Out_ int* pDay) override
+        {
+            CivilFromDays(unit, pYear, pMonth, pDay);
+            return true;
+        }
+
+        // Samoa skipped a day in 2011, so counting Gregorian days doesn't match the calendar's days there.
+        bool CanUseCivilArithmetic() override
+        {
+            return !IsUsingSamoaTimeZone(false /*forceUpdate*/);
+        }
+
         _Check_return_ HRESULT UpdateLabel(_In_ CalendarViewBaseItem* pItem, _In_ bool isLabelVisible) override;
 
         _Check_return_ HRESULT CompareDate(_In_ wf::DateTime lhs, _In_ wf::DateTime rhs, _Out_ int* pResult) override;
@@ -45,6 +45,11 @@ namespace DirectUI
         _Check_return_ HRESULT GetLastUnitInThisScope(_Out_ int* pValue) override;
         _Check_return_ HRESULT OnScopeChanged() override;
 
+        INT64 GetCivilUnit(_In_ int year, _In_ int month, _In_ int day) override
+        {
+            return static_cast<INT64>(year) * 12 + month - 1;
+        }
+
         _Check_return_ HRESULT UpdateLabel(_In_ CalendarViewBaseItem* pItem, _In_ bool isLabelVisible) override;
 
         _Check_return_ HRESULT CompareDate(_In_ wf::DateTime lhs, _In_ wf::DateTime rhs, _Out_ int* pResult) override;
@@ -25,6 +25,10 @@ namespace DirectUI
 
         void ClearOwner();
 
+        // False for groups over a source that isn't observable, whose item
+        // changes never reach the owner.
+        bool NotifiesItemChanges() const { return !!m_tpObservableItems; }
+
         _Check_return_ HRESULT get_GroupImpl(_Outptr_ IInspectable** pValue);
         _Check_return_ HRESULT get_GroupItemsImpl(_Outptr_ wfc::IObservableVector<IInspectable*>** pValue);
 
@@ -29,44 +29,24 @@ GroupedDataCollectionView::~GroupedDataCollectionView()
 
 IFACEMETHODIMP GroupedDataCollectionView::GetAt(_In_opt_ UINT index, _Out_  IInspectable **item)
 {
-    HRESULT hr = S_OK;
-    UINT nGroups = 0;
-    UINT nGroupSize = 0;
-    UINT nGroupBaseIndex = 0;
-    ICollectionViewGroup *pGroup = NULL;
-    ctl::ComPtr<wfc::IObservableVector<IInspectable *>> spGroups;
+    UINT nGroupIndex = 0;
+    UINT nIndexInGroup = 0;
+    bool fFound = false;
+    ctl::ComPtr<ICollectionViewGroup> spGroup;
 
     ARG_VALIDRETURNPOINTER(item);
 
-    IFC(get_CollectionGroups(&spGroups));
-
-    IFC(spGroups.Cast<ReadOnlyObservableTrackerCollection<IInspectable *>>()->get_Size(&nGroups));
+    IFC_RETURN(FindGroupOfItem(index, &nGroupIndex, &nIndexInGroup, &fFound));
 
-    for (UINT i = 0; i < nGroups; i++)
+    // The index is in one of the groups, retrieve
+    // the item from it and return it
+    if (fFound)
     {
-        IFC(GetGroupAt(i, &pGroup));
-        IFC(GetGroupSize(pGroup, &nGroupSize));
-
-        // The index is in this group, retrieve the
-        // the item from it and return it
-        if (index < (nGroupBaseIndex + nGroupSize))
-        {
-            IFC(GetGroupItem(pGroup, index - nGroupBaseIndex, item));
-            goto Cleanup;
-        }
-
-        // The index is not in this group, update the base index and
-        // move on to the next group
-        nGroupBaseIndex += nGroupSize;
-
-        ReleaseInterface(pGroup);
+        IFC_RETURN(GetGroupAt(nGroupIndex, &spGroup));
+        IFC_RETURN(GetGroupItem(spGroup.Get(), nIndexInGroup, item));
     }
 
-Cleanup:
-
-    ReleaseInterface(pGroup);
-
-    RRETURN(hr);
+    return S_OK;
 }
 
 IFACEMETHODIMP GroupedDataCollectionView::get_Size(_Out_ UINT *size)
@@ -107,52 +87,86 @@ Cleanup:
 
 IFACEMETHODIMP GroupedDataCollectionView::IndexOf(_In_opt_ IInspectable * value, _Out_ UINT *index, _Out_ BOOLEAN *found)
 {
-    HRESULT hr = S_OK;
     UINT nGroups = 0;
     UINT nCurrentIndex = 0;
-    UINT nGroupSize = 0;
-    ICollectionViewGroup *pGroup = NULL;
-    wfc::IVector<IInspectable *> *pItems = NULL;
     ctl::ComPtr<wfc::IObservableVector<IInspectable *>> spGroups;
 
     ARG_VALIDRETURNPOINTER(index);
     ARG_VALIDRETURNPOINTER(found);
 
-    IFC(get_CollectionGroups(&spGroups));
-    IFC(spGroups.Cast<ReadOnlyObservableTrackerCollection<IInspectable *>>()->get_Size(&nGroups));
+    *index = 0;
+    *found = false;
+
+    IFC_RETURN(EnsureGroupIndex());
+
+    // Looking the same value up again, nothing changed since its first occurrence
+    // was found so only its group needs to be searched
+    if (m_areGroupSizesIndexed && m_tpIndexOfHintValue)
+    {
+        bool areEqual = false;
+
+        IFC_RETURN(PropertyValue::AreEqual(value, m_tpIndexOfHintValue.Get(), &areEqual));
+        if (areEqual)
+        {
+            ctl::ComPtr<ICollectionViewGroup> spGroup;
+            ctl::ComPtr<wfc::IVector<IInspectable *>> spItems;
+
+            IFC_RETURN(GetGroupAt(m_nIndexOfHintGroupIndex, &spGroup));
+            IFC_RETURN(GetGroupItems(spGroup.Get(), &spItems));
+            IFC_RETURN(spItems->IndexOf(value, index, found));
 
+            if (*found)
+            {
+                *index += GetIndexedSizeOfGroupsBefore(m_nIndexOfHintGroupIndex);
+                return S_OK;
+            }
+        }
+    }
+
+    IFC_RETURN(get_CollectionGroups(&spGroups));
+    IFC_RETURN(spGroups.Cast<ReadOnlyObservableTrackerCollection<IInspectable *>>()->get_Size(&nGroups));
+
+    // Search the groups in order so that the first occurrence of the value wins.
     for (UINT i = 0; i < nGroups; i++)
     {
-        IFC(GetGroupAt(i, &pGroup));
-        IFC(GetGroupItems(pGroup, &pItems));
+        UINT nGroupSize = 0;
+        ctl::ComPtr<ICollectionViewGroup> spGroup;
+        ctl::ComPtr<wfc::IVector<IInspectable *>> spItems;
+
+        IFC_RETURN(GetGroupAt(i, &spGroup));
+        IFC_RETURN(GetGroupItems(spGroup.Get(), &spItems));
 
-        IFC(pItems->get_Size(&nGroupSize));
-        IFC(pItems->IndexOf(value, index, found));
+        // Empty groups don't need to be searched
+        IFC_RETURN(spItems->get_Size(&nGroupSize));
+        if (nGroupSize == 0)
+        {
+            continue;
+        }
+
+        IFC_RETURN(spItems->IndexOf(value, index, found));
 
         // If we found the value in the current group we need to
         // offset the index by the current cumulative index
         if (*found)
         {
             *index += nCurrentIndex;
-            goto Cleanup;
+
+            if (m_areGroupSizesIndexed)
+            {
+                SetPtrValue(m_tpIndexOfHintValue, value);
+                m_nIndexOfHintGroupIndex = i;
+            }
+            return S_OK;
         }
 
         // Advance to the next group
         nCurrentIndex += nGroupSize;
-
-        ReleaseInterface(pGroup);
-        ReleaseInterface(pItems);
     }
 
     *index = 0;
     *found = false;
 
-Cleanup:
-
-    ReleaseInterface(pGroup);
-    ReleaseInterface(pItems);
-
-    RRETURN(hr);
+    return S_OK;
 }
 
 // IIterable<IInspectable *>
@@ -212,15 +226,24 @@ GroupedDataCollectionView::OnGroupItemsChanged(
     UINT nGroupIndex = 0;
     UINT nGroupBaseIndex = 0;
     UINT nGroupItemsIndex = 0;
-    BOOLEAN fGroupFound = false;
-    ctl::ComPtr<wfc::IObservableVector<IInspectable *>> spGroups;
+    UINT nGroupSize = 0;
 
-    IFC(get_CollectionGroups(&spGroups));
-    IFC(spGroups.Cast<ReadOnlyObservableTrackerCollection<IInspectable *>>()->IndexOf(pGroup, &nGroupIndex, &fGroupFound));
-    IFCEXPECT(fGroupFound);
+    IFC(EnsureGroupIndex());
+
+    {
+        auto itGroup = m_groupIndexes.find(static_cast<CollectionViewGroup*>(pGroup));
+        IFCEXPECT(itGroup != m_groupIndexes.end());
+        nGroupIndex = itGroup->second;
+    }
 
     IFC(GetBaseIndexOfGroup(nGroupIndex, &nGroupBaseIndex));
 
+    // The group's items already changed, record its new size before
+    // anyone reacting to the notification asks for items
+    IFC(GetGroupSize(pGroup, &nGroupSize));
+    SetIndexedGroupSize(nGroupIndex, nGroupSize);
+    m_tpIndexOfHintValue.Clear();
+
     IFC(pArgs->get_CollectionChange(&change));
 
     switch (change)
@@ -342,6 +365,7 @@ GroupedDataCollectionView::CalculateGroups()
 
     ClearGroupsOwner();
     IFC(pGroups->InternalClear());
+    InvalidateGroupIndex();
 
     IFC(m_tpSource->get_Size(&nSize));
 
@@ -351,6 +375,7 @@ GroupedDataCollectionView::CalculateGroups()
         IFC(CalculateCollectionViewGroup(pGroup, &pCVG));
 
         IFC(pGroups->InternalAppend(pCVG));
+        InvalidateGroupIndex();
 
         ReleaseInterface(pGroup);
         ReleaseInterface(pCVG);
@@ -413,34 +438,31 @@ _Check_return_
 HRESULT
 GroupedDataCollectionView::CalculateCount(_Out_ UINT *count)
 {
-    HRESULT hr = S_OK;
     UINT nGroups = 0;
-    UINT nGroupSize = 0;
-    ICollectionViewGroup *pGroup = NULL;
-    ctl::ComPtr<wfc::IObservableVector<IInspectable *>> spGroups;
 
-    // Long path sum the count of each group
     *count = 0;
 
-    IFC(get_CollectionGroups(&spGroups));
-    IFC(spGroups.Cast<ReadOnlyObservableTrackerCollection<IInspectable *>>()->get_Size(&nGroups));
+    IFC_RETURN(EnsureGroupIndex());
+    nGroups = static_cast<UINT>(m_groupSizes.size());
+
+    if (m_areGroupSizesIndexed)
+    {
+        *count = GetIndexedSizeOfGroupsBefore(nGroups);
+        return S_OK;
+    }
 
     for (UINT i = 0; i < nGroups; i++)
     {
-        IFC(GetGroupAt(i, &pGroup));
+        UINT nGroupSize = 0;
+        ctl::ComPtr<ICollectionViewGroup> spGroup;
 
-        IFC(GetGroupSize(pGroup, &nGroupSize));
+        IFC_RETURN(GetGroupAt(i, &spGroup));
+        IFC_RETURN(GetGroupSize(spGroup.Get(), &nGroupSize));
 
         *count += nGroupSize;
-
-        ReleaseInterface(pGroup);
     }
 
-Cleanup:
-
-    ReleaseInterface(pGroup);
-
-    RRETURN(hr);
+    return S_OK;
 }
 
 
@@ -493,6 +515,7 @@ GroupedDataCollectionView::OnGroupsChange(_In_ wfc::IVectorChangedEventArgs *pAr
         IFC(m_tpSource->GetAt(changeIndex, &pGroup));
         IFC(CalculateCollectionViewGroup(pGroup, &pCVG));
         IFC(pGroups->InternalInsertAt(changeIndex, pCVG));
+        InvalidateGroupIndex();
         IFC(NotifyOfGroupChange(changeIndex, change, pCVG));
         break;
 
@@ -502,6 +525,7 @@ GroupedDataCollectionView::OnGroupsChange(_In_ wfc::IVectorChangedEventArgs *pAr
         IFC(GetGroupAt(changeIndex, &pCVG));
         IFC(NotifyOfGroupChange(changeIndex, change, pCVG));
         IFC(pGroups->InternalRemoveAt(changeIndex));
+        InvalidateGroupIndex();
         static_cast<CollectionViewGroup*>(pCVG)->ClearOwner();
         break;
 
@@ -516,6 +540,7 @@ GroupedDataCollectionView::OnGroupsChange(_In_ wfc::IVectorChangedEventArgs *pAr
         IFC(m_tpSource->GetAt(changeIndex, &pGroup));
         IFC(CalculateCollectionViewGroup(pGroup, &pCVG));
         IFC(pGroups->InternalSetAt(changeIndex, pCVG));
+        InvalidateGroupIndex();
         IFC(NotifyOfGroupChange(changeIndex, wfc::CollectionChange_ItemInserted, pCVG));
         break;
 
@@ -637,52 +662,206 @@ _Check_return_
 HRESULT
 GroupedDataCollectionView::GetBaseIndexOfGroup(_In_ UINT nGroupIndex, _Out_ UINT *pnGroupBaseIndex)
 {
-    HRESULT hr = S_OK;
-    UINT nGroups = 0;
     UINT nCurrentIndex = 0;
-    UINT nGroupSize = 0;
-    IInspectable *pGroupInsp = NULL;
-    ICollectionViewGroup *pGroup = NULL;
-    wfc::IObservableVector<IInspectable *> *pObservableItems = NULL;
-    wfc::IVector<IInspectable *> *pItems = NULL;
-    ctl::ComPtr<wfc::IObservableVector<IInspectable *>> spGroups;
-    ReadOnlyObservableTrackerCollection<IInspectable *> *pGroups = NULL;
 
-    IFC(get_CollectionGroups(&spGroups));
-    spGroups.CastTo(&pGroups);
+    IFC_RETURN(EnsureGroupIndex());
+    IFCEXPECT_RETURN(nGroupIndex < m_groupSizes.size());
 
-    IFC(pGroups->get_Size(&nGroups));
-    IFCEXPECT(nGroupIndex < nGroups);
+    if (m_areGroupSizesIndexed)
+    {
+        *pnGroupBaseIndex = GetIndexedSizeOfGroupsBefore(nGroupIndex);
+        return S_OK;
+    }
 
     for (UINT i = 0; i < nGroupIndex; i++)
     {
-        IFC(pGroups->GetAt(i, &pGroupInsp));
-        IFC(ctl::do_query_interface(pGroup, pGroupInsp));
+        UINT nGroupSize = 0;
+        ctl::ComPtr<ICollectionViewGroup> spGroup;
 
-        IFC(pGroup->get_GroupItems(&pObservableItems));
-        IFC(ctl::do_query_interface(pItems, pObservableItems));
-
-        IFC(pItems->get_Size(&nGroupSize));
+        IFC_RETURN(GetGroupAt(i, &spGroup));
+        IFC_RETURN(GetGroupSize(spGroup.Get(), &nGroupSize));
 
         // Advance to the next group
         nCurrentIndex += nGroupSize;
-
-        ReleaseInterface(pGroupInsp);
-        ReleaseInterface(pGroup);
-        ReleaseInterface(pObservableItems);
-        ReleaseInterface(pItems);
     }
 
     *pnGroupBaseIndex = nCurrentIndex;
 
-Cleanup:
+    return S_OK;
+}
 
-    ReleaseInterface(pGroupInsp);
-    ReleaseInterface(pGroup);
-    ReleaseInterface(pObservableItems);
-    ReleaseInterface(pItems);
+_Check_return_
+HRESULT
+GroupedDataCollectionView::FindGroupOfItem(
+    _In_ UINT index,
+    _Out_ UINT *pnGroupIndex,
+    _Out_ UINT *pnIndexInGroup,
+    _Out_ bool *pfFound)
+{
+    UINT nGroups = 0;
+    UINT nGroupBaseIndex = 0;
 
-    RRETURN(hr);
+    IFC_RETURN(EnsureGroupIndex());
+    nGroups = static_cast<UINT>(m_groupSizes.size());
+
+    if (m_areGroupSizesIndexed)
+    {
+        *pfFound = FindIndexedGroupOfItem(index, pnGroupIndex, pnIndexInGroup);
+        return S_OK;
+    }
+
+    // Some group can change without telling us, walk the live sizes
+    for (UINT i = 0; i < nGroups; i++)
+    {
+        UINT nGroupSize = 0;
+        ctl::ComPtr<ICollectionViewGroup> spGroup;
+
+        IFC_RETURN(GetGroupAt(i, &spGroup));
+        IFC_RETURN(GetGroupSize(spGroup.Get(), &nGroupSize));
+
+        if (index - nGroupBaseIndex < nGroupSize)
+        {
+            *pnGroupIndex = i;
+            *pnIndexInGroup = index - nGroupBaseIndex;
+            *pfFound = true;
+            return S_OK;
+        }
+
+        nGroupBaseIndex += nGroupSize;
+    }
+
+    *pnGroupIndex = nGroups;
+    *pnIndexInGroup = nGroupBaseIndex;
+    *pfFound = false;
+
+    return S_OK;
+}
+
+_Check_return_
+HRESULT
+GroupedDataCollectionView::EnsureGroupIndex()
+{
+    UINT nGroups = 0;
+    ctl::ComPtr<wfc::IObservableVector<IInspectable *>> spGroups;
+
+    if (m_isGroupIndexValid)
+    {
+        return S_OK;
+    }
+
+    IFC_RETURN(get_CollectionGroups(&spGroups));
+    IFC_RETURN(spGroups.Cast<ReadOnlyObservableTrackerCollection<IInspectable *>>()->get_Size(&nGroups));
+
+    m_groupSizes.assign(nGroups, 0);
+    m_groupIndexes.clear();
+    m_groupIndexes.reserve(nGroups);
+    m_areGroupSizesIndexed = true;
+
+    for (UINT i = 0; i < nGroups; i++)
+    {
+        ctl::ComPtr<ICollectionViewGroup> spGroup;
+
+        IFC_RETURN(GetGroupAt(i, &spGroup));
+        IFC_RETURN(GetGroupSize(spGroup.Get(), &m_groupSizes[i]));
+        m_groupIndexes.emplace(spGroup.Cast<CollectionViewGroup>(), i);
+
+        if (!spGroup.Cast<CollectionViewGroup>()->NotifiesItemChanges())
+        {
+            m_areGroupSizesIndexed = false;
+        }
+    }
+
+    // Build the Fenwick tree in linear time
+    m_groupSizeTree.assign(nGroups + 1, 0);
+    for (UINT i = 1; i <= nGroups; i++)
+    {
+        const UINT parent = i + (i & (0u - i));
+
+        m_groupSizeTree[i] += m_groupSizes[i - 1];
+        if (parent <= nGroups)
+        {
+            m_groupSizeTree[parent] += m_groupSizeTree[i];
+        }
+    }
+
+    m_isGroupIndexValid = true;
+
+    return S_OK;
+}
+
+void
+GroupedDataCollectionView::InvalidateGroupIndex()
+{
+    m_isGroupIndexValid = false;
+    m_tpIndexOfHintValue.Clear();
+}
+
+void
+GroupedDataCollectionView::SetIndexedGroupSize(_In_ UINT nGroupIndex, _In_ UINT nGroupSize)
+{
+    const UINT delta = nGroupSize - m_groupSizes[nGroupIndex];
+
+    ASSERT(m_isGroupIndexValid);
+
+    m_groupSizes[nGroupIndex] = nGroupSize;
+
+    // Unsigned wrap-around makes this work for shrinking groups too
+    for (UINT i = nGroupIndex + 1; i < m_groupSizeTree.size(); i += i & (0u - i))
+    {
+        m_groupSizeTree[i] += delta;
+    }
+}
+
+UINT
+GroupedDataCollectionView::GetIndexedSizeOfGroupsBefore(_In_ UINT nGroupIndex) const
+{
+    UINT nSize = 0;
+
+    ASSERT(m_isGroupIndexValid);
+
+    for (UINT i = nGroupIndex; i > 0; i -= i & (0u - i))
+    {
+        nSize += m_groupSizeTree[i];
+    }
+
+    return nSize;
+}
+
+bool
+GroupedDataCollectionView::FindIndexedGroupOfItem(
+    _In_ UINT index,
+    _Out_ UINT *pnGroupIndex,
+    _Out_ UINT *pnIndexInGroup) const
+{
+    const UINT nGroups = static_cast<UINT>(m_groupSizes.size());
+    UINT nGroupIndex = 0;
+    UINT nRemaining = index;
+    UINT mask = 1;
+
+    ASSERT(m_isGroupIndexValid);
+
+    while (mask * 2 <= nGroups)
+    {
+        mask *= 2;
+    }
+
+    // Find the most groups whose sizes add up to no more than the index,
+    // the item is then in the group right after them. Empty groups are
+    // skipped over since they don't change the sum.
+    for (; mask != 0 && nGroups > 0; mask /= 2)
+    {
+        const UINT next = nGroupIndex + mask;
+        if (next <= nGroups && m_groupSizeTree[next] <= nRemaining)
+        {
+            nGroupIndex = next;
+            nRemaining -= m_groupSizeTree[next];
+        }
+    }
+
+    *pnGroupIndex = nGroupIndex;
+    *pnIndexInGroup = nRemaining;
+
+    return nGroupIndex < nGroups;
 }
 
 _Check_return_
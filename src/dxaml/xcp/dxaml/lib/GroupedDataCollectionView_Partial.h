@@ -12,6 +12,7 @@
 
 namespace DirectUI
 {
+    class CollectionViewGroup;
     class PropertyPathListener;
 
     // This class will not do any kind of virtualization of the
@@ -94,6 +95,29 @@ namespace DirectUI
 
         _Check_return_ HRESULT GetBaseIndexOfGroup(_In_ UINT nGroupIndex, _Out_ UINT *pnGroupBaseIndex);
 
+        // The group index keeps the size of every group in a Fenwick tree, so that
+        // a flat index maps to its group and back in O(log G). It is rebuilt on demand
+        // after the set of groups changes and kept current as group items change.
+        // Its sizes are only trusted while every group raises change notifications;
+        // otherwise lookups walk the live group sizes.
+        _Check_return_ HRESULT EnsureGroupIndex();
+        void InvalidateGroupIndex();
+
+        _Check_return_ HRESULT FindGroupOfItem(
+            _In_ UINT index,
+            _Out_ UINT *pnGroupIndex,
+            _Out_ UINT *pnIndexInGroup,
+            _Out_ bool *pfFound);
+
+        void SetIndexedGroupSize(_In_ UINT nGroupIndex, _In_ UINT nGroupSize);
+        UINT GetIndexedSizeOfGroupsBefore(_In_ UINT nGroupIndex) const;
+
+        // Returns false if the index is past the last item.
+        bool FindIndexedGroupOfItem(
+            _In_ UINT index,
+            _Out_ UINT *pnGroupIndex,
+            _Out_ UINT *pnIndexInGroup) const;
+
         _Check_return_ HRESULT GetGroupItems(
             _In_ xaml_data::ICollectionViewGroup *pGroup,
             _Outptr_ wfc::IVector<IInspectable *> **ppItems);
@@ -116,6 +140,17 @@ namespace DirectUI
         static const UINT cNumberOfItemsNotCached = static_cast<UINT>(-1);
         UINT m_nNumberOfItemsInAllGroups;
 
+        std::vector<UINT> m_groupSizes;
+        std::vector<UINT> m_groupSizeTree;
+        std::unordered_map<CollectionViewGroup*, UINT> m_groupIndexes;
+        bool m_isGroupIndexValid = false;
+        bool m_areGroupSizesIndexed = false;
+
+        // The last value found by IndexOf and the group holding its first
+        // occurrence, cleared on any change to the groups or their items.
+        TrackerPtr<IInspectable> m_tpIndexOfHintValue;
+        UINT m_nIndexOfHintGroupIndex = 0;
+
         TrackerPtr<wfc::IVector<IInspectable *>> m_tpSource;
         TrackerPtr<wfc::IObservableVector<IInspectable *>> m_tpObservable;
         TrackerPtr<wfc::IObservableVector<IInspectable *>> m_tpCollectionGroups;
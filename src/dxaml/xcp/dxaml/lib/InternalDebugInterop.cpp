@@ -984,6 +984,30 @@ InternalDebugInterop::SetShowingFrameCounter(
     return S_OK;
 }
 
+HRESULT
+InternalDebugInterop::GetRecentFramePhases(
+    _In_ UINT16 maxFrames,
+    _Out_ std::vector<FramePhaseProfile>* pFrames)
+{
+    CCoreServices *pCoreServices = GetCore();
+
+    pCoreServices->GetFramePhaseProfiler().GetRecentFrames(maxFrames, pFrames);
+
+    return S_OK;
+}
+
+HRESULT
+InternalDebugInterop::GetFramePhaseStatistics(
+    _In_ UINT16 maxFrames,
+    _Out_ FramePhaseStatistics* pStatistics)
+{
+    CCoreServices *pCoreServices = GetCore();
+
+    *pStatistics = pCoreServices->GetFramePhaseProfiler().GetStatistics(maxFrames);
+
+    return S_OK;
+}
+
 #pragma endregion
 
 #pragma region Other Methods
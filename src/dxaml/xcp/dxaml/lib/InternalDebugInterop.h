@@ -191,6 +191,14 @@ public:
     HRESULT SetShowingFrameCounter(
         _In_ bool bFrameCounterEnabled) override;
 
+    HRESULT GetRecentFramePhases(
+        _In_ UINT16 maxFrames,
+        _Out_ std::vector<FramePhaseProfile>* pFrames) override;
+
+    HRESULT GetFramePhaseStatistics(
+        _In_ UINT16 maxFrames,
+        _Out_ FramePhaseStatistics* pStatistics) override;
+
     #pragma endregion
 
     #pragma region Other Methods
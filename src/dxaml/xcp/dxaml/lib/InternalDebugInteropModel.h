@@ -15,6 +15,8 @@
 class CClassInfo;
 class CJupiterControl;
 class CCoreServices;
+struct FramePhaseProfile;
+struct FramePhaseStatistics;
 
 namespace DebugTool
 {
@@ -406,6 +408,16 @@ namespace DebugTool
         virtual HRESULT SetShowingFrameCounter(
             _In_ bool bFrameCounterEnabled) = 0;
 
+        // Phase timings of up to maxFrames of the most recent UI thread frames, newest first.
+        virtual HRESULT GetRecentFramePhases(
+            _In_ UINT16 maxFrames,
+            _Out_ std::vector<FramePhaseProfile>* pFrames) = 0;
+
+        // Median and 99th percentile of each frame phase over up to maxFrames of the most recent frames.
+        virtual HRESULT GetFramePhaseStatistics(
+            _In_ UINT16 maxFrames,
+            _Out_ FramePhaseStatistics* pStatistics) = 0;
+
         #pragma endregion
 
         #pragma region Other Methods
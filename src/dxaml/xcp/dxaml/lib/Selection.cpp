@@ -552,6 +552,14 @@ Selection::SelectionChangerImpl::CreateDeltaSelectionChange(
     // there's a side-path we don't know about.
     ASSERT(nSelectedCount == 0 || m_indexDeletedDuringThisChange.empty);
 
+    // Unselecting many items (e.g. clearing a large selection) would otherwise
+    // compact the selected items once per item.
+    m_pOwnerNoRef->m_spSelectedItems->DeferRemovals();
+    auto commitRemovalsGuard = wil::scope_exit([&]
+    {
+        IGNOREHR(m_pOwnerNoRef->m_spSelectedItems->CommitRemovals());
+    });
+
     for (UINT nIndex = 0; nIndex < nUnselectedCount; ++nIndex)
     {
         ctl::ComPtr<IInspectable> spItem;
@@ -585,6 +593,9 @@ Selection::SelectionChangerImpl::CreateDeltaSelectionChange(
         IFC_RETURN(pUnselectedItems->Append(spItem.Get()));
     }
 
+    commitRemovalsGuard.release();
+    IFC_RETURN(m_pOwnerNoRef->m_spSelectedItems->CommitRemovals());
+
     // Select all selected items
     for (UINT nIndex = 0; nIndex < nSelectedCount; ++nIndex)
     {
@@ -624,7 +635,7 @@ Selection::InternalSelectedItemsStorage::Add(
     _In_ IInspectable* pItem)
 {
     HRESULT hr = S_OK;
-    m_indexlist.push_back(itemIndex);
+    m_indexes.Append(itemIndex);
     IFC(TrackerCollection::Append(pItem));
 
 Cleanup:
@@ -638,21 +649,7 @@ Selection::InternalSelectedItemsStorage::Has(
     _Out_ UINT& position,
     _Out_ BOOLEAN& hasItem)
 {
-    hasItem = FALSE;
-    position = 0;
-
-    std::vector<UINT>::iterator it;
-    UINT nPosition = 0;
-
-    for (nPosition = 0, it = m_indexlist.begin(); it != m_indexlist.end(); ++nPosition, ++it)
-    {
-        if (*it == itemIndex)
-        {
-            position = nPosition;
-            hasItem = TRUE;
-            break;
-        }
-    }
+    hasItem = m_indexes.Find(itemIndex, position);
 
     RRETURN(S_OK);
 }
@@ -663,7 +660,8 @@ Selection::InternalSelectedItemsStorage::GetIndexAt(
     _In_ UINT position,
     _Out_ UINT& itemIndex)
 {
-    itemIndex = m_indexlist.at(position);
+    IFCEXPECTRC_RETURN(position < m_indexes.Size(), E_BOUNDS);
+    itemIndex = m_indexes.GetAt(position);
     RRETURN(S_OK);
 }
 
@@ -672,17 +670,9 @@ HRESULT
 Selection::InternalSelectedItemsStorage::Inserted(
     _In_ UINT itemIndex)
 {
-    std::vector<UINT>::iterator it;
-
     // An item was inserted. Update the selected index
     // list so our indexes keep matching up.
-    for (it = m_indexlist.begin(); it != m_indexlist.end(); ++it)
-    {
-        if (itemIndex <= *it)
-        {
-            ++(*it);
-        }
-    }
+    m_indexes.ShiftForInsert(itemIndex);
     RRETURN(S_OK);
 }
 
@@ -691,34 +681,21 @@ HRESULT
 Selection::InternalSelectedItemsStorage::Removed(
     _In_ UINT itemIndex)
 {
-    HRESULT hr = S_OK;
-
-    std::vector<UINT>::iterator it;
-    UINT indexInIndexList = 0;
+    std::vector<UINT> removedPositions;
 
     // An item was removed. Update the selected index
     // list so our indexes keep matching up.
     // We also need to remove the item which has been removed.
-    for (it = m_indexlist.begin(); it != m_indexlist.end();)
+    m_indexes.ShiftForRemove(itemIndex, removedPositions);
+
+    // Positions come back in descending order, so removing one
+    // doesn't move the ones left to remove.
+    for (UINT position : removedPositions)
     {
-        if (itemIndex == *it)
-        {
-            it = m_indexlist.erase(it);
-            IFC(TrackerCollection::RemoveAt(indexInIndexList));
-        }
-        else
-        {
-            if (itemIndex < *it)
-            {
-                --(*it);
-            }
-            ++it;
-            ++indexInIndexList;
-        }
+        IFC_RETURN(TrackerCollection::RemoveAt(position));
     }
 
-Cleanup:
-    RRETURN(hr);
+    return S_OK;
 }
 
 // Returns a copy of the list of selected indexes.
@@ -726,8 +703,69 @@ std::vector<UINT>
 Selection::InternalSelectedItemsStorage::GetSelectedIndexes() const
 {
     // Clone the selected index list.
-    return m_indexlist;
+    return m_indexes.GetIndexes();
+
+}
+
+void
+Selection::InternalSelectedItemsStorage::DeferRemovals()
+{
+    ASSERT(!m_isDeferringRemovals);
+    m_isDeferringRemovals = true;
+}
+
+_Check_return_
+HRESULT
+Selection::InternalSelectedItemsStorage::CommitRemovals()
+{
+    // Above this many removals, copying the surviving items is cheaper
+    // than removing the items one at a time.
+    static constexpr size_t s_rebuildThreshold = 16;
+
+    std::vector<UINT> removedPositions;
+
+    ASSERT(m_isDeferringRemovals);
+    m_isDeferringRemovals = false;
 
+    m_indexes.FlushDeferredRemovals(removedPositions);
+
+    if (removedPositions.size() <= s_rebuildThreshold)
+    {
+        for (UINT position : removedPositions)
+        {
+            IFC_RETURN(TrackerCollection::RemoveAt(position));
+        }
+    }
+    else
+    {
+        const UINT size = Size();
+        std::vector<ctl::ComPtr<IInspectable>> items;
+        auto removedPosition = removedPositions.rbegin();
+
+        items.reserve(size - removedPositions.size());
+
+        for (UINT position = 0; position < size; ++position)
+        {
+            if (removedPosition != removedPositions.rend() && *removedPosition == position)
+            {
+                ++removedPosition;
+                continue;
+            }
+
+            ctl::ComPtr<IInspectable> spItem;
+            IFC_RETURN(TrackerCollection::GetAt(position, &spItem));
+            items.push_back(std::move(spItem));
+        }
+
+        IFC_RETURN(TrackerCollection::Clear());
+
+        for (const auto& spItem : items)
+        {
+            IFC_RETURN(TrackerCollection::Append(spItem.Get()));
+        }
+    }
+
+    return S_OK;
 }
 
 IFACEMETHODIMP
@@ -736,9 +774,13 @@ Selection::InternalSelectedItemsStorage::RemoveAt(
 {
     HRESULT hr = S_OK;
 
-    IFCEXPECTRC(position < m_indexlist.size(), E_BOUNDS);
-    m_indexlist.erase(m_indexlist.begin() + position);
-    IFC(TrackerCollection::RemoveAt(position));
+    IFCEXPECTRC(position < m_indexes.Size(), E_BOUNDS);
+    m_indexes.RemoveAt(position, m_isDeferringRemovals);
+
+    if (!m_isDeferringRemovals)
+    {
+        IFC(TrackerCollection::RemoveAt(position));
+    }
 
 Cleanup:
     RRETURN(hr);
@@ -748,7 +790,8 @@ IFACEMETHODIMP
 Selection::InternalSelectedItemsStorage::Clear()
 {
     HRESULT hr = S_OK;
-    m_indexlist.clear();
+    m_indexes.Clear();
+    m_isDeferringRemovals = false;
     IFC(TrackerCollection::Clear());
 
 Cleanup:
@@ -756,3 +799,552 @@ Cleanup:
 }
 
 #pragma endregion
+
+#pragma region SelectedIndexTree implementation
+
+void
+Selection::SelectedIndexTree::Append(
+    _In_ UINT itemIndex)
+{
+    const UINT node = AllocateNode(itemIndex);
+    UINT left = s_nil;
+    UINT right = s_nil;
+
+    // Stamps only grow, so the new entry goes after all the
+    // entries that already have the same item index.
+    Split(m_root, itemIndex, m_nodes[node].stamp, left, right);
+    SetRoot(Merge(Merge(left, node), right));
+}
+
+bool
+Selection::SelectedIndexTree::Find(
+    _In_ UINT itemIndex,
+    _Out_ UINT& position) const
+{
+    UINT found = s_nil;
+    UINT shift = 0;
+
+    position = 0;
+
+    // Find the leftmost entry with this item index, accumulating the
+    // shifts not yet pushed down from the ancestors.
+    for (UINT node = m_root; node != s_nil;)
+    {
+        const Node& current = m_nodes[node];
+        const UINT currentItemIndex = current.itemIndex + shift;
+
+        shift += static_cast<UINT>(current.pendingShift);
+
+        if (currentItemIndex < itemIndex)
+        {
+            node = current.right;
+        }
+        else
+        {
+            if (currentItemIndex == itemIndex)
+            {
+                found = node;
+            }
+            node = current.left;
+        }
+    }
+
+    if (found == s_nil)
+    {
+        return false;
+    }
+
+    position = CountStampsBefore(m_nodes[found].stamp);
+    return true;
+}
+
+UINT
+Selection::SelectedIndexTree::GetAt(
+    _In_ UINT position) const
+{
+    ASSERT(position < m_count);
+    return GetItemIndex(m_nodeByStamp[FindStamp(position)]);
+}
+
+void
+Selection::SelectedIndexTree::RemoveAt(
+    _In_ UINT position,
+    _In_ bool deferred)
+{
+    ASSERT(position < m_count);
+    const UINT node = m_nodeByStamp[FindStamp(position)];
+
+    Detach(node);
+
+    if (deferred)
+    {
+        m_deferredRemovals.push_back(node);
+    }
+    else
+    {
+        ReleaseNode(node);
+    }
+}
+
+void
+Selection::SelectedIndexTree::FlushDeferredRemovals(
+    _Out_ std::vector<UINT>& positions)
+{
+    positions.clear();
+    positions.reserve(m_deferredRemovals.size());
+
+    for (UINT node : m_deferredRemovals)
+    {
+        positions.push_back(CountStampsBefore(m_nodes[node].stamp));
+    }
+
+    for (UINT node : m_deferredRemovals)
+    {
+        ReleaseNode(node);
+    }
+
+    m_deferredRemovals.clear();
+    std::sort(positions.begin(), positions.end(), std::greater<UINT>());
+}
+
+void
+Selection::SelectedIndexTree::ShiftForInsert(
+    _In_ UINT itemIndex)
+{
+    UINT left = s_nil;
+    UINT middle = s_nil;
+    UINT right = s_nil;
+
+    if (itemIndex == s_customValueIndex)
+    {
+        return;
+    }
+
+    Split(m_root, itemIndex, 0, left, middle);
+    Split(middle, s_customValueIndex, 0, middle, right);
+    ApplyShift(middle, 1);
+    SetRoot(Merge(Merge(left, middle), right));
+}
+
+void
+Selection::SelectedIndexTree::ShiftForRemove(
+    _In_ UINT itemIndex,
+    _Out_ std::vector<UINT>& removedPositions)
+{
+    UINT left = s_nil;
+    UINT removed = s_nil;
+    UINT middle = s_nil;
+    UINT right = s_nil;
+    std::vector<UINT> removedNodes;
+
+    removedPositions.clear();
+
+    // Stamps are always below s_nil, so this puts every entry for
+    // itemIndex in 'removed'.
+    Split(m_root, itemIndex, 0, left, middle);
+    Split(middle, itemIndex, s_nil, removed, middle);
+
+    if (itemIndex != s_customValueIndex)
+    {
+        Split(middle, s_customValueIndex, 0, middle, right);
+        ApplyShift(middle, -1);
+    }
+
+    SetRoot(Merge(Merge(left, middle), right));
+
+    if (removed != s_nil)
+    {
+        removedNodes.push_back(removed);
+        for (size_t i = 0; i < removedNodes.size(); ++i)
+        {
+            const Node& current = m_nodes[removedNodes[i]];
+            if (current.left != s_nil)
+            {
+                removedNodes.push_back(current.left);
+            }
+            if (current.right != s_nil)
+            {
+                removedNodes.push_back(current.right);
+            }
+        }
+
+        removedPositions.reserve(removedNodes.size());
+        for (UINT node : removedNodes)
+        {
+            removedPositions.push_back(CountStampsBefore(m_nodes[node].stamp));
+        }
+
+        for (UINT node : removedNodes)
+        {
+            ReleaseNode(node);
+        }
+
+        std::sort(removedPositions.begin(), removedPositions.end(), std::greater<UINT>());
+    }
+}
+
+std::vector<UINT>
+Selection::SelectedIndexTree::GetIndexes() const
+{
+    std::vector<UINT> itemIndexByStamp(m_nextStamp);
+    std::vector<std::pair<UINT, UINT>> pending;
+    std::vector<UINT> indexes;
+
+    if (m_root != s_nil)
+    {
+        pending.emplace_back(m_root, 0);
+    }
+
+    while (!pending.empty())
+    {
+        const UINT node = pending.back().first;
+        const UINT shift = pending.back().second;
+        const Node& current = m_nodes[node];
+        const UINT childShift = shift + static_cast<UINT>(current.pendingShift);
+
+        pending.pop_back();
+        itemIndexByStamp[current.stamp] = current.itemIndex + shift;
+
+        if (current.left != s_nil)
+        {
+            pending.emplace_back(current.left, childShift);
+        }
+        if (current.right != s_nil)
+        {
+            pending.emplace_back(current.right, childShift);
+        }
+    }
+
+    // Entries removed with a deferred removal are out of the tree but
+    // still hold their positions.
+    for (UINT node : m_deferredRemovals)
+    {
+        itemIndexByStamp[m_nodes[node].stamp] = m_nodes[node].itemIndex;
+    }
+
+    indexes.reserve(m_count);
+    for (UINT stamp = 0; stamp < m_nextStamp; ++stamp)
+    {
+        if (m_nodeByStamp[stamp] != s_nil)
+        {
+            indexes.push_back(itemIndexByStamp[stamp]);
+        }
+    }
+
+    return indexes;
+}
+
+void
+Selection::SelectedIndexTree::Clear()
+{
+    m_nodes.clear();
+    m_freeNodes.clear();
+    m_deferredRemovals.clear();
+    m_nodeByStamp.clear();
+    m_stampCounts.clear();
+    m_root = s_nil;
+    m_nextStamp = 0;
+    m_count = 0;
+}
+
+UINT
+Selection::SelectedIndexTree::AllocateNode(
+    _In_ UINT itemIndex)
+{
+    const UINT stamp = AllocateStamp();
+    UINT node = s_nil;
+
+    if (!m_freeNodes.empty())
+    {
+        node = m_freeNodes.back();
+        m_freeNodes.pop_back();
+    }
+    else
+    {
+        node = static_cast<UINT>(m_nodes.size());
+        m_nodes.emplace_back();
+    }
+
+    // xorshift32 priorities keep the treap balanced in expectation.
+    m_prioritySeed ^= m_prioritySeed << 13;
+    m_prioritySeed ^= m_prioritySeed >> 17;
+    m_prioritySeed ^= m_prioritySeed << 5;
+
+    m_nodes[node] = { itemIndex, 0, m_prioritySeed, stamp, s_nil, s_nil, s_nil };
+    m_nodeByStamp[stamp] = node;
+    AddToStampCount(stamp, 1);
+    ++m_count;
+
+    return node;
+}
+
+void
+Selection::SelectedIndexTree::ReleaseNode(
+    _In_ UINT node)
+{
+    const UINT stamp = m_nodes[node].stamp;
+
+    m_nodeByStamp[stamp] = s_nil;
+    AddToStampCount(stamp, -1);
+    --m_count;
+    m_freeNodes.push_back(node);
+}
+
+UINT
+Selection::SelectedIndexTree::AllocateStamp()
+{
+    if (m_nextStamp == m_nodeByStamp.size())
+    {
+        const UINT capacity = static_cast<UINT>(m_nodeByStamp.size());
+
+        // Reuse the stamps of removed entries when at least half of them
+        // are free, otherwise make room for more.
+        RenumberStamps((capacity > 0 && m_count <= capacity / 2) ? capacity : std::max(16u, capacity * 2));
+    }
+
+    return m_nextStamp++;
+}
+
+void
+Selection::SelectedIndexTree::RenumberStamps(
+    _In_ UINT capacity)
+{
+    std::vector<UINT> nodeByStamp(capacity, s_nil);
+    UINT nextStamp = 0;
+
+    // Renumbering keeps the stamps in the same order, so the
+    // order of entries with the same item index is unchanged.
+    for (UINT stamp = 0; stamp < m_nextStamp; ++stamp)
+    {
+        const UINT node = m_nodeByStamp[stamp];
+        if (node != s_nil)
+        {
+            m_nodes[node].stamp = nextStamp;
+            nodeByStamp[nextStamp++] = node;
+        }
+    }
+
+    m_nodeByStamp = std::move(nodeByStamp);
+    m_nextStamp = nextStamp;
+
+    // Build the Fenwick tree in place in linear time.
+    m_stampCounts.assign(capacity + 1, 0);
+    for (UINT i = 1; i <= capacity; ++i)
+    {
+        if (i <= nextStamp)
+        {
+            ++m_stampCounts[i];
+        }
+
+        const UINT parent = i + (i & (0u - i));
+        if (parent <= capacity)
+        {
+            m_stampCounts[parent] += m_stampCounts[i];
+        }
+    }
+}
+
+void
+Selection::SelectedIndexTree::AddToStampCount(
+    _In_ UINT stamp,
+    _In_ INT delta)
+{
+    for (UINT i = stamp + 1; i < m_stampCounts.size(); i += i & (0u - i))
+    {
+        m_stampCounts[i] += static_cast<UINT>(delta);
+    }
+}
+
+UINT
+Selection::SelectedIndexTree::CountStampsBefore(
+    _In_ UINT stamp) const
+{
+    UINT count = 0;
+
+    for (UINT i = stamp; i > 0; i -= i & (0u - i))
+    {
+        count += m_stampCounts[i];
+    }
+
+    return count;
+}
+
+UINT
+Selection::SelectedIndexTree::FindStamp(
+    _In_ UINT position) const
+{
+    const UINT capacity = static_cast<UINT>(m_stampCounts.size()) - 1;
+    UINT mask = 1;
+    UINT stamp = 0;
+    UINT remaining = position;
+
+    while (mask * 2 <= capacity)
+    {
+        mask *= 2;
+    }
+
+    // Find the largest prefix of stamps holding no more than 'position'
+    // live entries; the entry at 'position' is the stamp right after it.
+    for (; mask != 0; mask /= 2)
+    {
+        const UINT next = stamp + mask;
+        if (next <= capacity && m_stampCounts[next] <= remaining)
+        {
+            stamp = next;
+            remaining -= m_stampCounts[next];
+        }
+    }
+
+    return stamp;
+}
+
+UINT
+Selection::SelectedIndexTree::GetItemIndex(
+    _In_ UINT node) const
+{
+    UINT itemIndex = m_nodes[node].itemIndex;
+
+    for (UINT ancestor = m_nodes[node].parent; ancestor != s_nil; ancestor = m_nodes[ancestor].parent)
+    {
+        itemIndex += static_cast<UINT>(m_nodes[ancestor].pendingShift);
+    }
+
+    return itemIndex;
+}
+
+void
+Selection::SelectedIndexTree::ApplyShift(
+    _In_ UINT node,
+    _In_ INT shift)
+{
+    if (node != s_nil)
+    {
+        m_nodes[node].itemIndex += static_cast<UINT>(shift);
+        m_nodes[node].pendingShift += shift;
+    }
+}
+
+void
+Selection::SelectedIndexTree::PushDown(
+    _In_ UINT node)
+{
+    const INT shift = m_nodes[node].pendingShift;
+
+    if (shift != 0)
+    {
+        ApplyShift(m_nodes[node].left, shift);
+        ApplyShift(m_nodes[node].right, shift);
+        m_nodes[node].pendingShift = 0;
+    }
+}
+
+void
+Selection::SelectedIndexTree::AttachChildren(
+    _In_ UINT node)
+{
+    if (m_nodes[node].left != s_nil)
+    {
+        m_nodes[m_nodes[node].left].parent = node;
+    }
+    if (m_nodes[node].right != s_nil)
+    {
+        m_nodes[m_nodes[node].right].parent = node;
+    }
+}
+
+UINT
+Selection::SelectedIndexTree::Merge(
+    _In_ UINT left,
+    _In_ UINT right)
+{
+    if (left == s_nil)
+    {
+        return right;
+    }
+    if (right == s_nil)
+    {
+        return left;
+    }
+
+    if (m_nodes[left].priority > m_nodes[right].priority)
+    {
+        PushDown(left);
+        m_nodes[left].right = Merge(m_nodes[left].right, right);
+        AttachChildren(left);
+        return left;
+    }
+    else
+    {
+        PushDown(right);
+        m_nodes[right].left = Merge(left, m_nodes[right].left);
+        AttachChildren(right);
+        return right;
+    }
+}
+
+void
+Selection::SelectedIndexTree::Split(
+    _In_ UINT node,
+    _In_ UINT itemIndex,
+    _In_ UINT stamp,
+    _Out_ UINT& left,
+    _Out_ UINT& right)
+{
+    if (node == s_nil)
+    {
+        left = s_nil;
+        right = s_nil;
+        return;
+    }
+
+    PushDown(node);
+
+    const Node& current = m_nodes[node];
+    if (current.itemIndex < itemIndex || (current.itemIndex == itemIndex && current.stamp < stamp))
+    {
+        Split(current.right, itemIndex, stamp, m_nodes[node].right, right);
+        AttachChildren(node);
+        left = node;
+    }
+    else
+    {
+        Split(current.left, itemIndex, stamp, left, m_nodes[node].left);
+        AttachChildren(node);
+        right = node;
+    }
+}
+
+void
+Selection::SelectedIndexTree::Detach(
+    _In_ UINT node)
+{
+    UINT left = s_nil;
+    UINT middle = s_nil;
+    UINT right = s_nil;
+    const UINT itemIndex = GetItemIndex(node);
+    const UINT stamp = m_nodes[node].stamp;
+
+    // Splitting pushes every pending shift down to the node, so its
+    // item index stays valid once it is out of the tree.
+    Split(m_root, itemIndex, stamp, left, middle);
+    Split(middle, itemIndex, stamp + 1, middle, right);
+    ASSERT(middle == node);
+
+    m_nodes[node].pendingShift = 0;
+    m_nodes[node].parent = s_nil;
+    SetRoot(Merge(left, right));
+}
+
+void
+Selection::SelectedIndexTree::SetRoot(
+    _In_ UINT node)
+{
+    m_root = node;
+
+    if (m_root != s_nil)
+    {
+        m_nodes[m_root].parent = s_nil;
+    }
+}
+
+#pragma endregion
@@ -100,12 +100,146 @@ namespace DirectUI
         BOOLEAN IsChangeActive();
 
     private:
+        // The item indexes of the selected items, in selection order.
+        // Entries are also kept sorted by item index in a treap whose nodes carry pending index
+        // shifts, so looking up an item index and shifting every index after an inserted or
+        // removed item are O(log n). Each entry gets an increasing stamp when it is appended, and
+        // a Fenwick tree over the live stamps maps entries to and from positions in selection order.
+        class SelectedIndexTree
+        {
+        public:
+            UINT Size() const
+            {
+                return m_count;
+            }
+
+            void Append(
+                _In_ UINT itemIndex);
+
+            // Finds the first entry, in selection order, with the given item index.
+            bool Find(
+                _In_ UINT itemIndex,
+                _Out_ UINT& position) const;
+
+            UINT GetAt(
+                _In_ UINT position) const;
+
+            // A deferred removal takes the entry out of the item index order right away, but the
+            // entry keeps its position until FlushDeferredRemovals is called.
+            void RemoveAt(
+                _In_ UINT position,
+                _In_ bool deferred);
+
+            // Releases the entries removed with RemoveAt(position, true) and returns their
+            // positions in descending order.
+            void FlushDeferredRemovals(
+                _Out_ std::vector<UINT>& positions);
+
+            // An item was inserted in the items collection.
+            void ShiftForInsert(
+                _In_ UINT itemIndex);
+
+            // An item was removed from the items collection. Entries with that index are removed
+            // and their positions are returned in descending order.
+            void ShiftForRemove(
+                _In_ UINT itemIndex,
+                _Out_ std::vector<UINT>& removedPositions);
+
+            std::vector<UINT> GetIndexes() const;
+
+            void Clear();
+
+        private:
+            static constexpr UINT s_nil = UINT_MAX;
+
+            // Custom values are stored with this index. They are not positions in the items
+            // collection, so they are never shifted.
+            static constexpr UINT s_customValueIndex = UINT_MAX;
+
+            struct Node
+            {
+                UINT itemIndex;
+                // Shift not yet applied to the descendants of this node.
+                INT pendingShift;
+                UINT priority;
+                UINT stamp;
+                UINT left;
+                UINT right;
+                UINT parent;
+            };
+
+            UINT AllocateNode(
+                _In_ UINT itemIndex);
+
+            void ReleaseNode(
+                _In_ UINT node);
+
+            UINT AllocateStamp();
+
+            void RenumberStamps(
+                _In_ UINT capacity);
+
+            void AddToStampCount(
+                _In_ UINT stamp,
+                _In_ INT delta);
+
+            UINT CountStampsBefore(
+                _In_ UINT stamp) const;
+
+            UINT FindStamp(
+                _In_ UINT position) const;
+
+            UINT GetItemIndex(
+                _In_ UINT node) const;
+
+            void ApplyShift(
+                _In_ UINT node,
+                _In_ INT shift);
+
+            void PushDown(
+                _In_ UINT node);
+
+            void AttachChildren(
+                _In_ UINT node);
+
+            UINT Merge(
+                _In_ UINT left,
+                _In_ UINT right);
+
+            // Splits the subtree into the entries ordered before (itemIndex, stamp) and the rest.
+            void Split(
+                _In_ UINT node,
+                _In_ UINT itemIndex,
+                _In_ UINT stamp,
+                _Out_ UINT& left,
+                _Out_ UINT& right);
+
+            void Detach(
+                _In_ UINT node);
+
+            void SetRoot(
+                _In_ UINT node);
+
+            std::vector<Node> m_nodes;
+            std::vector<UINT> m_freeNodes;
+            std::vector<UINT> m_deferredRemovals;
+
+            // Node for each stamp, or s_nil once the entry was removed.
+            std::vector<UINT> m_nodeByStamp;
+
+            // Fenwick tree counting the live stamps.
+            std::vector<UINT> m_stampCounts;
+
+            UINT m_root = s_nil;
+            UINT m_nextStamp = 0;
+            UINT m_count = 0;
+            UINT m_prioritySeed = 2463534242;
+        };
+
         // A collection of selected items with their associated indexes in the items collection.
         // Conceptually, a List<Pair<IInspectable, UINT>>, where the UINT is the
         // index of the respective selected item. The Collection superclass is used for its ability
-        // to properly handle IInspectable references.
-        // Ideally, this would be replaced with a single list of IInspectable, UINT pairs for greater
-        // performance.
+        // to properly handle IInspectable references, and the indexes live in a SelectedIndexTree.
         class InternalSelectedItemsStorage : public TrackerCollection<IInspectable*>
         {
         public:
@@ -131,6 +265,13 @@ namespace DirectUI
             // Returns a copy of the list of selected indexes.
             std::vector<UINT> GetSelectedIndexes() const;
 
+            // Until CommitRemovals is called, RemoveAt only removes entries from the index lookup
+            // and the removed items keep their positions, so removing many items at once
+            // compacts the collection a single time.
+            void DeferRemovals();
+
+            _Check_return_ HRESULT CommitRemovals();
+
             IFACEMETHODIMP SetAt(
                 _In_ unsigned itemIndex,
                 _In_ IInspectable* pItem) override
@@ -161,7 +302,8 @@ namespace DirectUI
             IFACEMETHOD(Clear)() override;
 
         private:
-            std::vector<UINT> m_indexlist;
+            SelectedIndexTree m_indexes;
+            bool m_isDeferringRemovals = false;
         };
 
         class SelectionChangerImpl final : public SelectionChanger
@@ -1301,7 +1301,16 @@ CWindowsDownloadRequest::Abort()
         // If we don't have a binding, then we can't abort the download
         if (m_pBinding)
         {
-            IGNOREHR(m_pBinding->Abort());
+            // The binding belongs to the apartment of the job queue thread that started it, and urlmon delivers its
+            // callbacks through that thread's message pump. Abort it there, ahead of any bind starts queued behind it.
+            // The deferral taken in OnStartBinding keeps that thread alive until OnStopBinding.
+            m_pDownloader->GetJobQueue().QueueJobForWindow(
+                m_hwnd,
+                [binding = xref_ptr<IBinding>(m_pBinding)] (HWND)
+                {
+                    IGNOREHR(binding->Abort());
+                },
+                ThreadedJobQueue::JobPriority::High);
             m_xResult = E_FAIL;
         }
         else